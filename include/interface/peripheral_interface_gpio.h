@@ -21,6 +21,7 @@
 
 #define GPIO_BUFFER_MAX 64
 
+int peripheral_interface_gpio_open_chardev(peripheral_gpio_h gpio, int pin);
 void peripheral_interface_gpio_close(peripheral_gpio_h gpio);
 
 int peripheral_interface_gpio_set_initial_edge_into_handle(peripheral_gpio_h gpio);
@@ -34,5 +35,30 @@ int peripheral_interface_gpio_read(peripheral_gpio_h gpio, uint32_t *value);
 
 int peripheral_interface_gpio_set_interrupted_cb(peripheral_gpio_h gpio, peripheral_gpio_interrupted_cb callback, void *user_data);
 int peripheral_interface_gpio_unset_interrupted_cb(peripheral_gpio_h gpio);
+int peripheral_interface_gpio_set_interrupted_cb_delivery(peripheral_gpio_h gpio, peripheral_gpio_callback_delivery_e delivery, void *main_context);
+
+int peripheral_interface_gpio_set_event_queue(peripheral_gpio_h gpio, int size);
+int peripheral_interface_gpio_unset_event_queue(peripheral_gpio_h gpio);
+int peripheral_interface_gpio_read_events(peripheral_gpio_h gpio, peripheral_gpio_event_s *events, int max_count, int *count);
+
+int peripheral_interface_gpio_set_debounce(peripheral_gpio_h gpio, uint32_t stable_time_us, uint32_t min_pulse_width_us);
+
+int peripheral_interface_gpio_set_edge_counter(peripheral_gpio_h gpio, uint32_t window_ms);
+int peripheral_interface_gpio_unset_edge_counter(peripheral_gpio_h gpio);
+int peripheral_interface_gpio_get_edge_count(peripheral_gpio_h gpio, uint64_t *count);
+int peripheral_interface_gpio_get_edge_frequency(peripheral_gpio_h gpio, double *frequency);
+
+int peripheral_interface_gpio_set_pulse_capture(peripheral_gpio_h gpio, int size);
+int peripheral_interface_gpio_unset_pulse_capture(peripheral_gpio_h gpio);
+int peripheral_interface_gpio_read_pulses(peripheral_gpio_h gpio, peripheral_gpio_pulse_s *pulses, int max_count, int *count);
+
+int peripheral_interface_gpio_port_open_chardev(peripheral_gpio_port_h port, int *pins, int count);
+void peripheral_interface_gpio_port_close(peripheral_gpio_port_h port);
+int peripheral_interface_gpio_port_set_direction(peripheral_gpio_port_h port, uint64_t mask, peripheral_gpio_direction_e direction);
+int peripheral_interface_gpio_port_read_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t *bits);
+int peripheral_interface_gpio_port_write_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t bits);
+int peripheral_interface_gpio_port_start_waveform(peripheral_gpio_port_h port, const peripheral_gpio_waveform_step_s *steps, int count, int repeat);
+int peripheral_interface_gpio_port_wait_waveform(peripheral_gpio_port_h port);
+int peripheral_interface_gpio_port_stop_waveform(peripheral_gpio_port_h port);
 
 #endif/*__PERIPHERAL_INTERFACE_GPIO_H__*/
\ No newline at end of file
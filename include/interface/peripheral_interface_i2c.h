@@ -22,8 +22,22 @@
 #define I2C_BUFFER_MAX 64
 
 #define I2C_SLAVE	0x0703	/* Use this slave address */
+#define I2C_FUNCS	0x0705	/* Get the adapter functionality mask */
+#define I2C_RDWR	0x0707	/* Combined R/W transfer (one STOP only) */
 #define I2C_SMBUS	0x0720	/* SMBus transfer */
 
+#define I2C_RDWR_IOCTL_MAX_MSGS	42	/* Maximum number of messages per I2C_RDWR */
+#define I2C_RDWR_LENGTH_MAX	8192	/* Maximum length of a message */
+
+#define I2C_EEPROM_WRITE_TIMEOUT_US	100000	/* Longest write cycle waited for, in microseconds */
+#define I2C_EEPROM_POLL_INTERVAL_US	100	/* Time between two acknowledge polls, in microseconds */
+
+/* i2c_msg flags */
+#define I2C_M_RD		0x0001	/* read data, from slave to master */
+#define I2C_M_IGNORE_NAK	0x1000
+#define I2C_M_NOSTART		0x4000
+#define I2C_M_STOP		0x8000
+
 /* i2c_smbus_xfer read or write markers */
 #define I2C_SMBUS_READ	1
 #define I2C_SMBUS_WRITE	0
@@ -33,6 +47,20 @@
 #define I2C_SMBUS_BYTE		    1
 #define I2C_SMBUS_BYTE_DATA	    2
 #define I2C_SMBUS_WORD_DATA	    3
+#define I2C_SMBUS_BLOCK_DATA	    5
+#define I2C_SMBUS_I2C_BLOCK_DATA    8
+
+/* Adapter functionality bits returned by I2C_FUNCS */
+#define I2C_FUNC_I2C			0x00000001
+#define I2C_FUNC_SMBUS_READ_BYTE	0x00020000
+#define I2C_FUNC_SMBUS_WRITE_BYTE	0x00040000
+#define I2C_FUNC_SMBUS_READ_BYTE_DATA	0x00080000
+#define I2C_FUNC_SMBUS_WRITE_BYTE_DATA	0x00100000
+#define I2C_FUNC_SMBUS_READ_BLOCK_DATA	0x01000000
+#define I2C_FUNC_SMBUS_WRITE_BLOCK_DATA	0x02000000
+#define I2C_FUNC_SMBUS_READ_I2C_BLOCK	0x04000000
+#define I2C_FUNC_SMBUS_WRITE_I2C_BLOCK	0x08000000
+#define I2C_FUNC_SMBUS_I2C_BLOCK	(I2C_FUNC_SMBUS_READ_I2C_BLOCK | I2C_FUNC_SMBUS_WRITE_I2C_BLOCK)
 
 /*
  * Data for SMBus Messages
@@ -54,6 +82,20 @@ struct i2c_smbus_ioctl_data {
 	union i2c_smbus_data *data;
 };
 
+/* This is the structure as used in the I2C_RDWR ioctl call */
+struct i2c_msg {
+	uint16_t addr;
+	uint16_t flags;
+	uint16_t len;
+	uint8_t *buf;
+};
+
+struct i2c_rdwr_ioctl_data {
+	struct i2c_msg *msgs;
+	uint32_t nmsgs;
+};
+
+int peripheral_interface_i2c_probe(peripheral_i2c_h i2c);
 void peripheral_interface_i2c_close(peripheral_i2c_h i2c);
 int peripheral_interface_i2c_read(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
 int peripheral_interface_i2c_write(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
@@ -61,5 +103,39 @@ int peripheral_interface_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t re
 int peripheral_interface_i2c_write_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t data_in);
 int peripheral_interface_i2c_read_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t *data_out);
 int peripheral_interface_i2c_write_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t data_in);
+int peripheral_interface_i2c_transfer(peripheral_i2c_h i2c, struct i2c_msg *msgs, int count);
+int peripheral_interface_i2c_read_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length);
+int peripheral_interface_i2c_write_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length);
+int peripheral_interface_i2c_transaction_submit(peripheral_i2c_transaction_h transaction);
+int peripheral_interface_i2c_read_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t *length);
+int peripheral_interface_i2c_write_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length);
+int peripheral_interface_i2c_read_i2c_block(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length);
+int peripheral_interface_i2c_write_i2c_block(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length);
+int peripheral_interface_i2c_get_transfer_path(peripheral_i2c_h i2c, peripheral_i2c_transfer_path_e *path);
+int peripheral_interface_i2c_set_register_cacheable(peripheral_i2c_h i2c, uint8_t reg, bool cacheable);
+int peripheral_interface_i2c_set_register_cache_mode(peripheral_i2c_h i2c, peripheral_i2c_register_cache_mode_e mode);
+int peripheral_interface_i2c_update_register_bits(peripheral_i2c_h i2c, uint8_t reg, uint8_t mask, uint8_t value);
+int peripheral_interface_i2c_sync_registers(peripheral_i2c_h i2c);
+int peripheral_interface_i2c_invalidate_register_cache(peripheral_i2c_h i2c);
+int peripheral_interface_i2c_attach_bus(peripheral_i2c_h i2c);
+void peripheral_interface_i2c_detach_bus(peripheral_i2c_h i2c);
+int peripheral_interface_i2c_read_async(peripheral_i2c_h i2c, uint8_t *data_out, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+int peripheral_interface_i2c_write_async(peripheral_i2c_h i2c, uint8_t *data_in, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+int peripheral_interface_i2c_read_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+int peripheral_interface_i2c_write_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+int peripheral_interface_i2c_transaction_submit_async(peripheral_i2c_transaction_h transaction, peripheral_i2c_completed_cb callback, void *user_data);
+int peripheral_interface_i2c_get_completion_fd(peripheral_i2c_h i2c, int *fd);
+int peripheral_interface_i2c_set_priority(peripheral_i2c_h i2c, int priority);
+int peripheral_interface_i2c_set_max_hold_time(peripheral_i2c_h i2c, uint32_t hold_time_us);
+int peripheral_interface_i2c_poller_add_job(peripheral_i2c_poller_h poller, peripheral_i2c_h i2c, uint8_t reg, uint32_t length, uint32_t period_us, int size, int *job_id);
+int peripheral_interface_i2c_poller_start(peripheral_i2c_poller_h poller);
+int peripheral_interface_i2c_poller_stop(peripheral_i2c_poller_h poller);
+void peripheral_interface_i2c_poller_destroy(peripheral_i2c_poller_h poller);
+int peripheral_interface_i2c_poller_read_samples(peripheral_i2c_poller_h poller, int job_id, uint8_t *data, uint64_t *timestamps, int max_count, int *count);
+int peripheral_interface_i2c_eeprom_write(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t page_size, uint32_t offset, uint8_t *data_in, uint32_t length);
+int peripheral_interface_i2c_eeprom_read(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t offset, uint8_t *data_out, uint32_t length);
+int peripheral_interface_i2c_set_register_format(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, peripheral_i2c_endian_e endian);
+int peripheral_interface_i2c_read_register_words(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data_out, uint32_t count);
+int peripheral_interface_i2c_write_register_words(peripheral_i2c_h i2c, uint16_t reg, const uint16_t *data_in, uint32_t count);
 
 #endif /* __PERIPHERAL_INTERFACE_I2C_H__ */
@@ -19,13 +19,26 @@
 
 #include "peripheral_interface_common.h"
 
+#define SPI_SEGMENTS_MAX 511	/* Largest N for which SPI_IOC_MESSAGE(N) fits in the ioctl size field */
+
+int peripheral_interface_spi_probe(peripheral_spi_h spi);
 void peripheral_interface_spi_close(peripheral_spi_h spi);
 int peripheral_interface_spi_set_mode(peripheral_spi_h spi, peripheral_spi_mode_e mode);
 int peripheral_interface_spi_set_bit_order(peripheral_spi_h spi, peripheral_spi_bit_order_e bit_order);
+int peripheral_interface_spi_set_bus_width(peripheral_spi_h spi, peripheral_spi_bus_width_e tx_width, peripheral_spi_bus_width_e rx_width);
 int peripheral_interface_spi_set_bits_per_word(peripheral_spi_h spi, uint8_t bits);
 int peripheral_interface_spi_set_frequency(peripheral_spi_h spi, uint32_t freq);
 int peripheral_interface_spi_read(peripheral_spi_h spi, uint8_t *rxbuf, uint32_t length);
 int peripheral_interface_spi_write(peripheral_spi_h spi, uint8_t *txbuf, uint32_t length);
 int peripheral_interface_spi_transfer(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length);
+int peripheral_interface_spi_transfer_with_settings(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length, uint32_t speed_hz, uint8_t bits);
+int peripheral_interface_spi_transfer_segments(peripheral_spi_h spi, peripheral_spi_segment_s *segments, int count);
+int peripheral_interface_spi_set_chunk_cs_hold(peripheral_spi_h spi, bool hold);
+int peripheral_interface_spi_get_max_transfer_size(peripheral_spi_h spi, uint32_t *size);
+int peripheral_interface_spi_start_stream(peripheral_spi_h spi, uint8_t *txdata, uint32_t frame_size, int frames, int count, peripheral_spi_stream_cb callback, void *user_data);
+int peripheral_interface_spi_stop_stream(peripheral_spi_h spi);
+int peripheral_interface_spi_get_stream_fd(peripheral_spi_h spi, int *fd);
+int peripheral_interface_spi_read_stream(peripheral_spi_h spi, uint8_t *data, uint32_t length);
+int peripheral_interface_spi_get_stream_overruns(peripheral_spi_h spi, uint32_t *overruns);
 
 #endif /* __PERIPHERAL_INTERFACE_SPI_H__ */
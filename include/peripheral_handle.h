@@ -20,32 +20,175 @@
 #include <gio/gio.h>
 
 typedef struct _peripheral_gpio_interrupted_cb_info_s {
-	GThread *thread;
 	peripheral_gpio_interrupted_cb cb;
 	peripheral_error_e error;
 	void *user_data;
 	gint status;
+	peripheral_gpio_callback_delivery_e delivery;
+	GMainContext *context;
 } interrupted_cb_info_s;
 
+typedef struct _peripheral_gpio_event_queue_s {
+	peripheral_gpio_event_s *events;
+	guint size;
+	gint head;
+	gint tail;
+} gpio_event_queue_s;
+
+typedef struct _peripheral_gpio_debounce_s {
+	uint32_t stable_us;
+	uint32_t min_pulse_us;
+	bool software;
+	bool pending;
+	uint64_t deadline;
+	peripheral_gpio_event_s pending_edge;
+} gpio_debounce_s;
+
+#define GPIO_COUNTER_SLOTS 16
+
+typedef struct _peripheral_gpio_edge_counter_s {
+	uint64_t total;
+	uint64_t started;
+	uint64_t slot_ns;
+	uint64_t slot_start;
+	guint slot;
+	uint32_t slots[GPIO_COUNTER_SLOTS];
+} gpio_edge_counter_s;
+
+typedef enum {
+	GPIO_PULSE_CAPTURE_IDLE = 0,
+	GPIO_PULSE_CAPTURE_HIGH,
+	GPIO_PULSE_CAPTURE_LOW,
+} gpio_pulse_capture_state_e;
+
+typedef struct _peripheral_gpio_pulse_capture_s {
+	peripheral_gpio_pulse_s *pulses;
+	guint size;
+	gint head;
+	gint tail;
+	gpio_pulse_capture_state_e state;
+	uint64_t rise;
+	uint64_t fall;
+} gpio_pulse_capture_s;
+
+typedef enum {
+	GPIO_BACKEND_SYSFS = 0,
+	GPIO_BACKEND_CHARDEV,
+} gpio_backend_e;
+
 /**
  * @brief Internal struct for gpio context
  */
 struct _peripheral_gpio_s {
 	uint handle;
+	gpio_backend_e backend;
 	int fd_direction;
 	int fd_edge;
 	int fd_value;
+	int fd_line;
 	peripheral_gpio_direction_e direction;
 	peripheral_gpio_edge_e edge;
 	interrupted_cb_info_s cb_info;
+	guint watch_id;
+	uint32_t seqno;
+	gpio_event_queue_s *queue;
+	gpio_debounce_s debounce;
+	gpio_edge_counter_s *counter;
+	gpio_pulse_capture_s *capture;
+};
+
+#define GPIO_PORT_LINES_MAX 64
+
+typedef struct _peripheral_gpio_waveform_s {
+	GThread *thread;
+	peripheral_gpio_waveform_step_s *steps;
+	int count;
+	int repeat;
+	gint stop;
+	gint done;
+	int error;
+	int event_fd;
+} gpio_waveform_s;
+
+/**
+ * @brief Internal struct for gpio port context
+ */
+struct _peripheral_gpio_port_s {
+	gpio_backend_e backend;
+	int fd_line;
+	int count;
+	uint64_t output;
+	peripheral_gpio_h gpio[GPIO_PORT_LINES_MAX];
+	gpio_waveform_s *waveform;
 };
 
 /**
  * @brief Internal struct for i2c context
  */
+#define I2C_REGISTER_CACHE_SIZE 256
+
+typedef struct _peripheral_i2c_bus_s i2c_bus_s;
+
+typedef struct _peripheral_i2c_register_cache_s {
+	peripheral_i2c_register_cache_mode_e mode;
+	uint8_t values[I2C_REGISTER_CACHE_SIZE];
+	uint32_t cacheable[I2C_REGISTER_CACHE_SIZE / 32];
+	uint32_t valid[I2C_REGISTER_CACHE_SIZE / 32];
+	uint32_t dirty[I2C_REGISTER_CACHE_SIZE / 32];
+} i2c_register_cache_s;
+
 struct _peripheral_i2c_s {
 	uint handle;
 	int fd;
+	int bus;
+	int address;
+	unsigned long funcs;
+	peripheral_i2c_transfer_path_e path;
+	i2c_register_cache_s *cache;
+	i2c_bus_s *arbiter;
+	int priority;
+	uint32_t max_hold_time;
+	int pending;
+	int event_fd;
+	peripheral_i2c_address_width_e address_width;
+	peripheral_i2c_endian_e endian;
+};
+
+#define I2C_TRANSACTION_MSGS_MAX 42
+
+typedef struct _peripheral_i2c_transaction_msg_s {
+	uint8_t *buf;
+	uint16_t len;
+	bool read;
+	int flags;
+} i2c_transaction_msg_s;
+
+struct _peripheral_i2c_transaction_s {
+	peripheral_i2c_h i2c;
+	int count;
+	i2c_transaction_msg_s msgs[I2C_TRANSACTION_MSGS_MAX];
+};
+
+#define I2C_POLLER_JOBS_MAX 32
+
+typedef struct _peripheral_i2c_poll_job_s {
+	peripheral_i2c_h i2c;
+	uint8_t reg;
+	uint32_t length;
+	uint64_t period;
+	uint64_t next;
+	uint8_t *samples;
+	uint64_t *timestamps;
+	guint size;
+	gint head;
+	gint tail;
+} i2c_poll_job_s;
+
+struct _peripheral_i2c_poller_s {
+	GThread *thread;
+	gint stop;
+	int count;
+	i2c_poll_job_s jobs[I2C_POLLER_JOBS_MAX];
 };
 
 /**
@@ -75,12 +218,40 @@ struct _peripheral_uart_s {
 	int fd;
 };
 
+typedef struct _peripheral_spi_stream_s {
+	GThread *thread;
+	gint stop;
+	gint error;
+	uint8_t *txdata;
+	uint32_t frame_size;
+	int frames;
+	uint32_t block_size;
+	guint count;
+	uint8_t *blocks;
+	uint8_t *scratch;
+	gint head;
+	gint tail;
+	gint overruns;
+	int event_fd;
+	peripheral_spi_stream_cb callback;
+	void *user_data;
+} spi_stream_s;
+
 /**
  * @brief Internal struct for spi context
  */
 struct _peripheral_spi_s {
 	uint handle;
 	int fd;
+	uint32_t max_transfer;
+	bool cs_hold;
+	uint32_t mode;
+	uint8_t bits;
+	uint32_t freq;
+	unsigned int cached;
+	uint8_t tx_nbits;
+	uint8_t rx_nbits;
+	spi_stream_s *stream;
 };
 
 #endif /* __PERIPHERAL_HANDLE_H__ */
@@ -167,6 +167,7 @@ int peripheral_gpio_set_direction(peripheral_gpio_h gpio, peripheral_gpio_direct
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
  * @remarks To set the edge mode to #PERIPHERAL_GPIO_EDGE_RISING, #PERIPHERAL_GPIO_EDGE_FALLING, #PERIPHERAL_GPIO_EDGE_BOTH, the data direction must be set to the #PERIPHERAL_GPIO_DIRECTION_IN.
+ * @remarks While a pulse capture is set, the edge mode can not be changed from #PERIPHERAL_GPIO_EDGE_BOTH, call peripheral_gpio_unset_pulse_capture() first.
  *
  * @param[in] gpio The GPIO handle
  * @param[in] edge The edge mode of the GPIO pin
@@ -174,6 +175,7 @@ int peripheral_gpio_set_direction(peripheral_gpio_h gpio, peripheral_gpio_direct
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY A pulse capture is set on the GPIO pin
  * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
@@ -225,6 +227,8 @@ typedef void(*peripheral_gpio_interrupted_cb)(peripheral_gpio_h gpio, peripheral
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
  *
  * @post peripheral_gpio_unset_interrupted_cb()
@@ -251,6 +255,317 @@ int peripheral_gpio_set_interrupted_cb(peripheral_gpio_h gpio, peripheral_gpio_i
  */
 int peripheral_gpio_unset_interrupted_cb(peripheral_gpio_h gpio);
 
+/**
+ * @brief Enumeration of the ways the GPIO interrupted callback is delivered.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_GPIO_CALLBACK_DELIVERY_MAIN_LOOP = 0,  /**< The callback is invoked from a main loop (default) */
+	PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT,         /**< The callback is invoked on the internal event thread */
+} peripheral_gpio_callback_delivery_e;
+
+/**
+ * @platform
+ * @brief Sets how the GPIO interrupted callback is delivered.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks With #PERIPHERAL_GPIO_CALLBACK_DELIVERY_MAIN_LOOP the callback is invoked from the main loop running @a main_context, or from the default main loop if @a main_context is NULL.
+ * @remarks With #PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT the callback is invoked on the internal event thread as soon as the interrupt is handled and @a main_context is ignored. The callback must return quickly, as it delays the interrupts of every GPIO handle. It may unset the callback or close the handle.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[in] delivery The way the callback is delivered
+ * @param[in] main_context The GMainContext to deliver the callback to, or NULL for the default one
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_gpio_callback_delivery_e
+ * @see peripheral_gpio_set_interrupted_cb()
+ */
+int peripheral_gpio_set_interrupted_cb_delivery(peripheral_gpio_h gpio, peripheral_gpio_callback_delivery_e delivery, void *main_context);
+
+/**
+ * @brief The structure of a GPIO edge event.
+ * @since_tizen 5.0
+ */
+typedef struct {
+	uint64_t timestamp;  /**< Time of the edge in nanoseconds, on the CLOCK_MONOTONIC clock */
+	uint32_t value;      /**< Value of the GPIO pin after the edge */
+	uint32_t seqno;      /**< Sequence number of the edge, a gap means that edges were lost */
+} peripheral_gpio_event_s;
+
+/**
+ * @platform
+ * @brief Starts recording the GPIO edges into an event queue.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Every edge matching the edge mode is recorded with its timestamp, without merging bursts of edges.
+ * @remarks When the queue is full, new edges are dropped until peripheral_gpio_read_events() makes room for them.
+ * @remarks The event queue can be used together with the interrupted callback.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[in] size The number of events the queue can hold (1 ~ 65536)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @post peripheral_gpio_unset_event_queue()
+ * @see peripheral_gpio_set_edge_mode()
+ * @see peripheral_gpio_read_events()
+ */
+int peripheral_gpio_set_event_queue(peripheral_gpio_h gpio, int size);
+
+/**
+ * @platform
+ * @brief Stops recording the GPIO edges and releases the event queue.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] gpio The GPIO handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_event_queue()
+ */
+int peripheral_gpio_unset_event_queue(peripheral_gpio_h gpio);
+
+/**
+ * @platform
+ * @brief Takes the recorded GPIO edge events out of the event queue, oldest first.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks This function does not block, @a count is 0 when no edge has been recorded.
+ * @remarks This function must not be called from several threads at the same time for the same handle.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[out] events The array to store the events
+ * @param[in] max_count The maximum number of events to store in @a events
+ * @param[out] count The number of events stored in @a events
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_event_queue()
+ */
+int peripheral_gpio_read_events(peripheral_gpio_h gpio, peripheral_gpio_event_s *events, int max_count, int *count);
+
+/**
+ * @platform
+ * @brief Sets the debounce and glitch filter of the GPIO edges.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks An edge is reported only if the pin keeps its new value for @a stable_time_us. The kernel debounce is used when the GPIO line supports it, otherwise the edge is checked again once the stable time is over.
+ * @remarks An edge is held for @a min_pulse_width_us and reported only if the pin has not gone back to its previous value by then. A pulse shorter than that is dropped as a glitch, both its leading and its trailing edges, and the edges are reported that much later.
+ * @remarks The filter applies to both the interrupted callback and the event queue. A value of 0 disables the corresponding filter.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[in] stable_time_us The time in microseconds the pin must keep its value after an edge (0 ~ 1000000)
+ * @param[in] min_pulse_width_us The minimum time in microseconds a pulse must last to be reported (0 ~ 1000000)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_gpio_set_interrupted_cb()
+ * @see peripheral_gpio_set_event_queue()
+ */
+int peripheral_gpio_set_debounce(peripheral_gpio_h gpio, uint32_t stable_time_us, uint32_t min_pulse_width_us);
+
+/**
+ * @platform
+ * @brief Starts counting the GPIO edges.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The edges matching the edge mode are counted on the internal event thread, without invoking any callback.
+ * @remarks The frequency is measured over a sliding window of @a window_ms. Use #PERIPHERAL_GPIO_EDGE_RISING or #PERIPHERAL_GPIO_EDGE_FALLING to measure the frequency of the signal itself.
+ * @remarks Setting the edge counter again restarts it from 0.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[in] window_ms The length of the frequency window in milliseconds (1 ~ 60000)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @post peripheral_gpio_unset_edge_counter()
+ * @see peripheral_gpio_get_edge_count()
+ * @see peripheral_gpio_get_edge_frequency()
+ */
+int peripheral_gpio_set_edge_counter(peripheral_gpio_h gpio, uint32_t window_ms);
+
+/**
+ * @platform
+ * @brief Stops counting the GPIO edges.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] gpio The GPIO handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_edge_counter()
+ */
+int peripheral_gpio_unset_edge_counter(peripheral_gpio_h gpio);
+
+/**
+ * @platform
+ * @brief Gets the number of GPIO edges counted since the edge counter was set.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[out] count The number of edges
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_edge_counter()
+ */
+int peripheral_gpio_get_edge_count(peripheral_gpio_h gpio, uint64_t *count);
+
+/**
+ * @platform
+ * @brief Gets the rate of the GPIO edges over the sliding window of the edge counter.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Until the edge counter has run for a full window, the rate is measured over the time elapsed since it was set.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[out] frequency The number of edges per second
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_edge_counter()
+ */
+int peripheral_gpio_get_edge_frequency(peripheral_gpio_h gpio, double *frequency);
+
+/**
+ * @brief The structure of a GPIO pulse measurement.
+ * @since_tizen 5.0
+ */
+typedef struct {
+	uint64_t timestamp;  /**< Time of the rising edge ending the period in nanoseconds, on the CLOCK_MONOTONIC clock */
+	uint64_t high_time;  /**< Time the GPIO pin was high in nanoseconds */
+	uint64_t low_time;   /**< Time the GPIO pin was low in nanoseconds */
+	uint64_t period;     /**< Time between the two rising edges in nanoseconds */
+} peripheral_gpio_pulse_s;
+
+/**
+ * @platform
+ * @brief Starts measuring the GPIO pulses.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The pulses are measured on the internal event thread from the timestamps of the edges, from one rising edge to the next one.
+ * @remarks When an edge is lost, the pulse in progress is discarded. When the capture is full, new pulses are dropped until peripheral_gpio_read_pulses() makes room for them.
+ * @remarks The edge mode is kept at #PERIPHERAL_GPIO_EDGE_BOTH until peripheral_gpio_unset_pulse_capture() is called, peripheral_gpio_set_edge_mode() returns #PERIPHERAL_ERROR_RESOURCE_BUSY for any other mode.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[in] size The number of pulses the capture can hold (1 ~ 65536)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre The edge mode of the GPIO pin must be #PERIPHERAL_GPIO_EDGE_BOTH.
+ * @post peripheral_gpio_unset_pulse_capture()
+ * @see peripheral_gpio_read_pulses()
+ */
+int peripheral_gpio_set_pulse_capture(peripheral_gpio_h gpio, int size);
+
+/**
+ * @platform
+ * @brief Stops measuring the GPIO pulses and releases the captured ones.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] gpio The GPIO handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_pulse_capture()
+ */
+int peripheral_gpio_unset_pulse_capture(peripheral_gpio_h gpio);
+
+/**
+ * @platform
+ * @brief Takes the measured GPIO pulses out of the capture, oldest first.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks This function does not block, @a count is 0 when no pulse has been measured.
+ * @remarks This function must not be called from several threads at the same time for the same handle.
+ *
+ * @param[in] gpio The GPIO handle
+ * @param[out] pulses The array to store the pulses
+ * @param[in] max_count The maximum number of pulses to store in @a pulses
+ * @param[out] count The number of pulses stored in @a pulses
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_set_pulse_capture()
+ */
+int peripheral_gpio_read_pulses(peripheral_gpio_h gpio, peripheral_gpio_pulse_s *pulses, int max_count, int *count);
+
 /**
  * @platform
  * @brief Gets the current value of the GPIO pin.
@@ -300,31 +615,24 @@ int peripheral_gpio_read(peripheral_gpio_h gpio, uint32_t *value);
 int peripheral_gpio_write(peripheral_gpio_h gpio, uint32_t value);
 
 /**
-* @}
-*/
-
-/**
- * @addtogroup CAPI_SYSTEM_PERIPHERAL_IO_I2C_MODULE
- * @{
- */
-
-/**
- * @brief The handle of the I2C slave device.
- * @since_tizen 4.0
+ * @brief The handle of a group of GPIO pins.
+ * @since_tizen 5.0
  */
-typedef struct _peripheral_i2c_s *peripheral_i2c_h;
+typedef struct _peripheral_gpio_port_s *peripheral_gpio_port_h;
 
 /**
  * @platform
- * @brief Opens an I2C slave device.
- * @since_tizen 4.0
+ * @brief Opens a group of GPIO pins as a port.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
- * @remarks @a i2c should be released with peripheral_i2c_close()
+ * @remarks @a port should be released with peripheral_gpio_port_close()
+ * @remarks The i-th pin of @a pins is represented by bit i of the masks used by the port functions.
+ * @remarks When all pins are on the same GPIO chip, a masked read or write is done in one operation.
  *
- * @param[in] bus The I2C bus number that the slave device is connected
- * @param[in] address The address of the slave device
- * @param[out] i2c The I2C handle is created on success
+ * @param[in] pins The array of GPIO pin numbers
+ * @param[in] count The number of pins in @a pins (1 ~ 64)
+ * @param[out] port The GPIO port handle is created on success
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
@@ -337,40 +645,1264 @@ typedef struct _peripheral_i2c_s *peripheral_i2c_h;
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
  * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @post peripheral_i2c_close()
+ * @post peripheral_gpio_port_close()
  */
-int peripheral_i2c_open(int bus, int address, peripheral_i2c_h *i2c);
+int peripheral_gpio_port_open(int *pins, int count, peripheral_gpio_port_h *port);
 
 /**
  * @platform
- * @brief Closes an I2C slave device.
- * @since_tizen 4.0
+ * @brief Closes a GPIO port.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
  *
- * @param[in] i2c The I2C handle
+ * @param[in] port The GPIO port handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @pre peripheral_gpio_port_open()
+ */
+int peripheral_gpio_port_close(peripheral_gpio_port_h port);
+
+/**
+ * @platform
+ * @brief Sets the direction of the GPIO pins selected by the mask.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] port The GPIO port handle
+ * @param[in] mask The bit mask of the pins to configure
+ * @param[in] direction The direction of the selected pins
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY A waveform is playing on the port
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_gpio_direction_e
+ */
+int peripheral_gpio_port_set_direction(peripheral_gpio_port_h port, uint64_t mask, peripheral_gpio_direction_e direction);
+
+/**
+ * @platform
+ * @brief Gets the current values of the GPIO pins selected by the mask.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] port The GPIO port handle
+ * @param[in] mask The bit mask of the pins to read
+ * @param[out] bits The values of the selected pins, bits outside of @a mask are cleared
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_gpio_port_write_mask()
+ */
+int peripheral_gpio_port_read_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t *bits);
+
+/**
+ * @platform
+ * @brief Sets the values of the GPIO pins selected by the mask.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks All pins selected by @a mask must be set to #PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_HIGH or #PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW.
+ *
+ * @param[in] port The GPIO port handle
+ * @param[in] mask The bit mask of the pins to write
+ * @param[in] bits The values to set, bits outside of @a mask are ignored
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY A waveform is playing on the port
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_gpio_port_read_mask()
+ * @see peripheral_gpio_port_set_direction()
+ */
+int peripheral_gpio_port_write_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t bits);
+
+/**
+ * @brief The structure of a step of a GPIO waveform.
+ * @since_tizen 5.0
+ */
+typedef struct {
+	uint64_t mask;      /**< The bit mask of the pins to write */
+	uint64_t bits;      /**< The values to set, bits outside of mask are ignored */
+	uint32_t delay_ns;  /**< Time in nanoseconds between this step and the next one */
+} peripheral_gpio_waveform_step_s;
+
+/**
+ * @platform
+ * @brief Starts playing a waveform on the GPIO pins of the port.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The steps are played on an internal thread with real-time priority when allowed, each one at an absolute deadline so that the delays do not drift.
+ * @remarks The steps are copied, @a steps can be released once this function returns.
+ * @remarks All pins selected by the steps must be set to #PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_HIGH or #PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW.
+ * @remarks While the waveform is playing, peripheral_gpio_port_write_mask() and peripheral_gpio_port_set_direction() return #PERIPHERAL_ERROR_RESOURCE_BUSY.
+ *
+ * @param[in] port The GPIO port handle
+ * @param[in] steps The array of steps of the waveform
+ * @param[in] count The number of steps in @a steps
+ * @param[in] repeat The number of times the waveform is played, or 0 to play it until peripheral_gpio_port_stop_waveform() is called, which needs a step with a delay
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY A waveform is already playing
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_gpio_port_wait_waveform()
+ * @see peripheral_gpio_port_stop_waveform()
+ */
+int peripheral_gpio_port_start_waveform(peripheral_gpio_port_h port, const peripheral_gpio_waveform_step_s *steps, int count, int repeat);
+
+/**
+ * @platform
+ * @brief Waits until the waveform of the port has been played.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks This function returns immediately if no waveform has been started.
+ *
+ * @param[in] port The GPIO port handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed, or the waveform is repeated until it is stopped
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_port_start_waveform()
+ */
+int peripheral_gpio_port_wait_waveform(peripheral_gpio_port_h port);
+
+/**
+ * @platform
+ * @brief Stops the waveform of the port after the current step.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The pins keep the values of the last step played.
+ *
+ * @param[in] port The GPIO port handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_gpio_port_start_waveform()
+ */
+int peripheral_gpio_port_stop_waveform(peripheral_gpio_port_h port);
+
+/**
+* @}
+*/
+
+/**
+ * @addtogroup CAPI_SYSTEM_PERIPHERAL_IO_I2C_MODULE
+ * @{
+ */
+
+/**
+ * @brief The handle of the I2C slave device.
+ * @since_tizen 4.0
+ */
+typedef struct _peripheral_i2c_s *peripheral_i2c_h;
+
+/**
+ * @brief Enumeration of the ways data is moved to and from the I2C slave device.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_I2C_TRANSFER_PATH_I2C = 0,         /**< Plain I2C transfers of any length */
+	PERIPHERAL_I2C_TRANSFER_PATH_SMBUS_I2C_BLOCK, /**< SMBus I2C block transfers of up to 32 bytes */
+	PERIPHERAL_I2C_TRANSFER_PATH_SMBUS_BYTE,      /**< SMBus transfers of one byte */
+} peripheral_i2c_transfer_path_e;
+
+/**
+ * @platform
+ * @brief Opens an I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks @a i2c should be released with peripheral_i2c_close()
+ *
+ * @param[in] bus The I2C bus number that the slave device is connected
+ * @param[in] address The address of the slave device
+ * @param[out] i2c The I2C handle is created on success
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY Device is in use
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @post peripheral_i2c_close()
+ */
+int peripheral_i2c_open(int bus, int address, peripheral_i2c_h *i2c);
+
+/**
+ * @platform
+ * @brief Closes an I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @pre peripheral_i2c_open()
+ */
+int peripheral_i2c_close(peripheral_i2c_h i2c);
+
+/**
+ * @platform
+ * @brief Reads the bytes data from the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write()
+ */
+int peripheral_i2c_read(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Writes the bytes data to the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read()
+ */
+int peripheral_i2c_write(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Reads single byte data from the register of the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to read
+ * @param[out] data The single byte data to read
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write_register_byte()
+ */
+int peripheral_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data);
+
+/**
+ * @platform
+ * @brief Writes single byte data to the register of the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to write
+ * @param[in] data The single byte data to write
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_register_byte()
+ */
+int peripheral_i2c_write_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t data);
+
+/**
+ * @platform
+ * @brief Reads word data from the register of the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to read
+ * @param[out] data The word(2 bytes) data to read
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write_register_word()
+ */
+int peripheral_i2c_read_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t *data);
+
+/**
+ * @platform
+ * @brief Writes word data to the register of the I2C slave device.
+ * @since_tizen 4.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to write
+ * @param[in] data The word(2 bytes) data to write
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_register_word()
+ */
+int peripheral_i2c_write_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t data);
+
+/**
+ * @platform
+ * @brief Reads consecutive registers of the I2C slave device in one transfer.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The register address is written and the data is read back with a repeated start, without a stop in between.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to read
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8192)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write_registers()
+ */
+int peripheral_i2c_read_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Writes consecutive registers of the I2C slave device in one transfer.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to write
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8191)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_registers()
+ */
+int peripheral_i2c_write_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Reads an SMBus block from the register of the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The slave device sends the number of bytes of the block first, a block holds up to 32 bytes.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to read
+ * @param[out] data The data buffer to read
+ * @param[in,out] length The size of data buffer on input, the number of bytes read on output (in bytes)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed, or the block does not fit in @a data
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write_block_data()
+ */
+int peripheral_i2c_read_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t *length);
+
+/**
+ * @platform
+ * @brief Writes an SMBus block to the register of the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The number of bytes of the block is sent before the data.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device to write
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 32)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_block_data()
+ */
+int peripheral_i2c_write_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Reads consecutive registers of the I2C slave device with SMBus I2C block transfers.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Ranges longer than 32 bytes are split into several transfers, each one starting at its own register address.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to read
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes), @a reg + @a length must not exceed 256
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_write_i2c_block_data()
+ */
+int peripheral_i2c_read_i2c_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Writes consecutive registers of the I2C slave device with SMBus I2C block transfers.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Ranges longer than 32 bytes are split into several transfers, each one starting at its own register address.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to write
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes), @a reg + @a length must not exceed 256
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_i2c_block_data()
+ */
+int peripheral_i2c_write_i2c_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length);
+
+/**
+ * @brief The handle of a batch of I2C messages submitted in one transfer.
+ * @since_tizen 5.0
+ */
+typedef struct _peripheral_i2c_transaction_s *peripheral_i2c_transaction_h;
+
+/**
+ * @brief Enumeration of the flags of an I2C message.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_I2C_MESSAGE_FLAG_NONE       = 0,       /**< No flag */
+	PERIPHERAL_I2C_MESSAGE_FLAG_NO_START   = 1 << 0,  /**< The message continues the previous one, without a start and address */
+	PERIPHERAL_I2C_MESSAGE_FLAG_IGNORE_NAK = 1 << 1,  /**< A NAK from the slave device does not abort the transfer */
+	PERIPHERAL_I2C_MESSAGE_FLAG_STOP       = 1 << 2,  /**< A stop is sent after the message */
+} peripheral_i2c_message_flag_e;
+
+/**
+ * @platform
+ * @brief Creates an empty I2C transaction for the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The @a transaction should be released with peripheral_i2c_transaction_destroy().
+ *
+ * @param[in] i2c The I2C handle
+ * @param[out] transaction The I2C transaction handle is created on success
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @post peripheral_i2c_transaction_destroy()
+ */
+int peripheral_i2c_transaction_create(peripheral_i2c_h i2c, peripheral_i2c_transaction_h *transaction);
+
+/**
+ * @platform
+ * @brief Destroys the I2C transaction.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] transaction The I2C transaction handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_i2c_transaction_create()
+ */
+int peripheral_i2c_transaction_destroy(peripheral_i2c_transaction_h transaction);
+
+/**
+ * @platform
+ * @brief Adds a write message to the I2C transaction.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The data is not copied, @a data must stay valid until the transaction is submitted for the last time.
+ * @remarks A transaction holds up to 42 messages.
+ *
+ * @param[in] transaction The I2C transaction handle
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8192)
+ * @param[in] flags The bitwise OR of #peripheral_i2c_message_flag_e values
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter, or the transaction is full
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_transaction_add_read()
+ * @see peripheral_i2c_transaction_submit()
+ */
+int peripheral_i2c_transaction_add_write(peripheral_i2c_transaction_h transaction, uint8_t *data, uint32_t length, int flags);
+
+/**
+ * @platform
+ * @brief Adds a read message to the I2C transaction.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks @a data is filled when the transaction is submitted, it must stay valid until then.
+ * @remarks A transaction holds up to 42 messages.
+ *
+ * @param[in] transaction The I2C transaction handle
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8192)
+ * @param[in] flags The bitwise OR of #peripheral_i2c_message_flag_e values
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter, or the transaction is full
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_transaction_add_write()
+ * @see peripheral_i2c_transaction_submit()
+ */
+int peripheral_i2c_transaction_add_read(peripheral_i2c_transaction_h transaction, uint8_t *data, uint32_t length, int flags);
+
+/**
+ * @platform
+ * @brief Submits all messages of the I2C transaction in one transfer.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The messages are sent with repeated starts and a single stop at the end, unless their flags say otherwise.
+ * @remarks The messages are kept, so the same transaction can be submitted again.
+ *
+ * @param[in] transaction The I2C transaction handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_transaction_reset()
+ */
+int peripheral_i2c_transaction_submit(peripheral_i2c_transaction_h transaction);
+
+/**
+ * @platform
+ * @brief Removes all messages from the I2C transaction.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] transaction The I2C transaction handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ */
+int peripheral_i2c_transaction_reset(peripheral_i2c_transaction_h transaction);
+
+/**
+ * @platform
+ * @brief Gets the way data is moved to and from the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The path is chosen once when the I2C handle is opened, from the functionality reported by the I2C adapter.
+ * @remarks Without #PERIPHERAL_I2C_TRANSFER_PATH_I2C, peripheral_i2c_write() is limited to 33 bytes and I2C transactions are not supported.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[out] path The transfer path
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_transfer_path_e
+ */
+int peripheral_i2c_get_transfer_path(peripheral_i2c_h i2c, peripheral_i2c_transfer_path_e *path);
+
+/**
+ * @brief Enumeration of the ways writes to cacheable I2C registers reach the device.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_I2C_REGISTER_CACHE_WRITE_THROUGH = 0, /**< Writes go to the device and to the cache */
+	PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK,        /**< Writes stay in the cache until peripheral_i2c_sync_registers() */
+} peripheral_i2c_register_cache_mode_e;
+
+/**
+ * @platform
+ * @brief Declares whether a register of the I2C slave device is cached.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Registers are volatile until they are declared cacheable. Once a cacheable register is known, peripheral_i2c_read_register_byte() returns its value without accessing the bus.
+ * @remarks Only registers whose value changes by writes of this handle alone should be declared cacheable.
+ * @remarks Other writes to the device, such as peripheral_i2c_write(), drop the registers they may have changed from the cache.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device
+ * @param[in] cacheable true if the register is cached, false if it is volatile
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY The register has a value not synced to the device yet
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_update_register_bits()
+ */
+int peripheral_i2c_set_register_cacheable(peripheral_i2c_h i2c, uint8_t reg, bool cacheable);
+
+/**
+ * @platform
+ * @brief Sets how writes to the cacheable registers reach the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Switching back to #PERIPHERAL_I2C_REGISTER_CACHE_WRITE_THROUGH writes the registers not synced yet.
+ * @remarks Reads and writes not going through the register byte functions, like peripheral_i2c_read_registers() or peripheral_i2c_write(), first write the registers not synced yet they may touch.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] mode The register cache mode
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed, or no register is cacheable
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_i2c_set_register_cacheable()
+ * @see peripheral_i2c_sync_registers()
+ */
+int peripheral_i2c_set_register_cache_mode(peripheral_i2c_h i2c, peripheral_i2c_register_cache_mode_e mode);
+
+/**
+ * @platform
+ * @brief Updates the bits selected by the mask in the register of the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Nothing is written when the register already holds the value. The current value is taken from the cache when the register is cacheable.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The register address of the I2C slave device
+ * @param[in] mask The bits to update
+ * @param[in] value The new value of the bits, bits outside of @a mask are ignored
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ */
+int peripheral_i2c_update_register_bits(peripheral_i2c_h i2c, uint8_t reg, uint8_t mask, uint8_t value);
+
+/**
+ * @platform
+ * @brief Writes the cached registers not synced yet to the I2C slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Consecutive registers are written together, and as few transfers as possible are used.
+ *
+ * @param[in] i2c The I2C handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_set_register_cache_mode()
+ */
+int peripheral_i2c_sync_registers(peripheral_i2c_h i2c);
+
+/**
+ * @platform
+ * @brief Drops all values from the register cache, for example after the I2C slave device was reset.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Values not synced yet are lost.
+ *
+ * @param[in] i2c The I2C handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ */
+int peripheral_i2c_invalidate_register_cache(peripheral_i2c_h i2c);
+
+/**
+ * @brief Called when an asynchronous I2C request is done.
+ * @details The callback is invoked on the worker thread of the I2C bus, not on the thread which queued the request.
+ * @since_tizen 5.0
+ *
+ * @remarks The @a i2c must not be closed in the callback.
+ * @remarks The request is no longer queued when the callback is invoked, new requests can be queued from it.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] result The result of the request, #PERIPHERAL_ERROR_NONE on success
+ * @param[in] user_data The user data passed from the request function
+ *
+ * @see peripheral_i2c_read_async()
+ * @see peripheral_i2c_write_async()
+ */
+typedef void(*peripheral_i2c_completed_cb)(peripheral_i2c_h i2c, peripheral_error_e result, void *user_data);
+
+/**
+ * @platform
+ * @brief Reads the bytes data from the I2C slave device without blocking the caller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The request is queued and the function returns at once, @a callback is called with the result when the transfer is done.
+ * @remarks @a data is filled by the worker thread of the bus, it must stay valid until the request is done.
+ * @remarks Requests of the same handle are done in the order they were queued.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes)
+ * @param[in] callback The callback function to invoke when the request is done, it may be NULL
+ * @param[in] user_data The user data to be passed to the callback function
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_read()
+ */
+int peripheral_i2c_read_async(peripheral_i2c_h i2c, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Writes the bytes data to the I2C slave device without blocking the caller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The request is queued and the function returns at once, @a callback is called with the result when the transfer is done.
+ * @remarks The data is not copied, @a data must stay valid until the request is done.
+ * @remarks Requests of the same handle are done in the order they were queued.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes)
+ * @param[in] callback The callback function to invoke when the request is done, it may be NULL
+ * @param[in] user_data The user data to be passed to the callback function
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_write()
+ */
+int peripheral_i2c_write_async(peripheral_i2c_h i2c, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Reads consecutive registers of the I2C slave device without blocking the caller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The request is queued and the function returns at once, @a callback is called with the result when the transfer is done.
+ * @remarks @a data is filled by the worker thread of the bus, it must stay valid until the request is done.
+ * @remarks Requests of the same handle are done in the order they were queued.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to read
+ * @param[out] data The data buffer to read
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8192)
+ * @param[in] callback The callback function to invoke when the request is done, it may be NULL
+ * @param[in] user_data The user data to be passed to the callback function
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_read_registers()
+ */
+int peripheral_i2c_read_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Writes consecutive registers of the I2C slave device without blocking the caller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The request is queued and the function returns at once, @a callback is called with the result when the transfer is done.
+ * @remarks The data is not copied, @a data must stay valid until the request is done.
+ * @remarks Requests of the same handle are done in the order they were queued.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] reg The address of the first register of the I2C slave device to write
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes, 1 ~ 8191)
+ * @param[in] callback The callback function to invoke when the request is done, it may be NULL
+ * @param[in] user_data The user data to be passed to the callback function
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_write_registers()
+ */
+int peripheral_i2c_write_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Submits all messages of the I2C transaction without blocking the caller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The request is queued and the function returns at once, @a callback is called with the result when the transfer is done.
+ * @remarks The @a transaction and its buffers must not be changed or destroyed until the request is done.
+ *
+ * @param[in] transaction The I2C transaction handle
+ * @param[in] callback The callback function to invoke when the request is done, it may be NULL
+ * @param[in] user_data The user data to be passed to the callback function
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_transaction_submit()
+ */
+int peripheral_i2c_transaction_submit_async(peripheral_i2c_transaction_h transaction, peripheral_i2c_completed_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Gets a file descriptor which becomes readable when asynchronous requests of the I2C handle are done.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The @a fd is an eventfd owned by the handle, it is closed by peripheral_i2c_close().
+ * @remarks Reading 8 bytes from the @a fd returns the number of requests done since the last read.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[out] fd The completion file descriptor
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_read_async()
+ */
+int peripheral_i2c_get_completion_fd(peripheral_i2c_h i2c, int *fd);
+
+/**
+ * @platform
+ * @brief Sets the priority of the I2C handle on its bus.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks All handles opened on the same bus share it. When the bus becomes free, it is given to the waiting handle of highest priority, and in arrival order among handles of the same priority. This applies to the asynchronous requests queued for the bus as well.
+ * @remarks The priority is 0 by default. It cannot be changed while asynchronous requests of the handle are queued.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] priority The priority of the handle (0 ~ 99), a greater value is served first
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY Asynchronous requests of the handle are queued
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_i2c_set_max_hold_time()
+ */
+int peripheral_i2c_set_priority(peripheral_i2c_h i2c, int priority);
+
+/**
+ * @platform
+ * @brief Sets how long an operation of the I2C handle may keep the bus from the other handles.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Operations made of several transfers, like register ranges split in I2C block transfers or peripheral_i2c_sync_registers(), keep the bus from their first transfer to their last. Once @a hold_time_us has passed, the operation lets the waiting handles of the same or higher priority go first at its next transfer boundary.
+ * @remarks A single transfer is never interrupted, nor is the read and write of peripheral_i2c_update_register_bits(). The hold time is 0 by default, which means no limit.
+ *
+ * @param[in] i2c The I2C handle
+ * @param[in] hold_time_us The maximum hold time (in microseconds), 0 for no limit
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_set_priority()
+ */
+int peripheral_i2c_set_max_hold_time(peripheral_i2c_h i2c, uint32_t hold_time_us);
+
+/**
+ * @brief The handle of an engine which polls I2C registers periodically.
+ * @since_tizen 5.0
+ */
+typedef struct _peripheral_i2c_poller_s *peripheral_i2c_poller_h;
+
+/**
+ * @platform
+ * @brief Creates an I2C poller without any job.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The @a poller should be released with peripheral_i2c_poller_destroy().
+ *
+ * @param[out] poller The I2C poller handle is created on success
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @post peripheral_i2c_poller_destroy()
+ */
+int peripheral_i2c_poller_create(peripheral_i2c_poller_h *poller);
+
+/**
+ * @platform
+ * @brief Stops the I2C poller if it runs, and destroys it with its jobs and their samples.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] poller The I2C poller handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_i2c_poller_create()
+ */
+int peripheral_i2c_poller_destroy(peripheral_i2c_poller_h poller);
+
+/**
+ * @platform
+ * @brief Adds a job which reads a register range of an I2C slave device periodically.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks Jobs can only be added while the poller is stopped. A poller holds up to 32 jobs.
+ * @remarks The @a i2c must not be closed before the poller is destroyed.
+ * @remarks The jobs of the same bus which are due at the same time are read in one combined transfer when the adapter supports plain I2C.
+ *
+ * @param[in] poller The I2C poller handle
+ * @param[in] i2c The I2C handle of the slave device
+ * @param[in] reg The address of the first register to read
+ * @param[in] length The number of registers read for each sample (1 ~ 8192)
+ * @param[in] period_us The period of the job (in microseconds, 100 ~ 60000000)
+ * @param[in] size The number of samples the job can hold until they are read (1 ~ 65536)
+ * @param[out] job The identifier of the job in the poller
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY The poller is running
+ *
+ * @see peripheral_i2c_poller_read_samples()
+ */
+int peripheral_i2c_poller_add_job(peripheral_i2c_poller_h poller, peripheral_i2c_h i2c, uint8_t reg, uint32_t length, uint32_t period_us, int size, int *job);
+
+/**
+ * @platform
+ * @brief Starts the I2C poller.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The jobs are run on a real-time thread at absolute deadlines counted from the start, so the sample rate does not drift. Deadlines which cannot be met are skipped.
+ * @remarks When the samples of a job are not read in time and it is full, the job is skipped until there is room again.
+ *
+ * @param[in] poller The I2C poller handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_i2c_poller_add_job()
+ * @post peripheral_i2c_poller_stop()
+ */
+int peripheral_i2c_poller_start(peripheral_i2c_poller_h poller);
+
+/**
+ * @platform
+ * @brief Stops the I2C poller, the samples not read yet are kept.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] poller The I2C poller handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre peripheral_i2c_poller_start()
+ */
+int peripheral_i2c_poller_stop(peripheral_i2c_poller_h poller);
+
+/**
+ * @platform
+ * @brief Takes the samples of a job out of the I2C poller, oldest first.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks This function does not block, @a count is 0 when no sample has been taken.
+ * @remarks This function must not be called from several threads at the same time for the same job.
+ *
+ * @param[in] poller The I2C poller handle
+ * @param[in] job The identifier of the job
+ * @param[out] data The buffer to store the samples, of @a max_count times the length of the job (in bytes)
+ * @param[out] timestamps The array to store the CLOCK_MONOTONIC time of the samples (in nanoseconds), it may be NULL
+ * @param[in] max_count The maximum number of samples to store
+ * @param[out] count The number of samples stored
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_i2c_poller_add_job()
+ */
+int peripheral_i2c_poller_read_samples(peripheral_i2c_poller_h poller, int job, uint8_t *data, uint64_t *timestamps, int max_count, int *count);
+
+/**
+ * @brief Enumeration of the widths of the register or memory addresses of I2C slave devices.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_I2C_ADDRESS_WIDTH_8  = 1, /**< 8-bit addresses, sent in one byte */
+	PERIPHERAL_I2C_ADDRESS_WIDTH_16 = 2, /**< 16-bit addresses, sent in two bytes, most significant first */
+} peripheral_i2c_address_width_e;
+
+/**
+ * @platform
+ * @brief Writes a range of an I2C EEPROM, page by page.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The range is split on the page boundaries of the device. After each page, the device is polled until it acknowledges again, so the next page is written as soon as the write cycle is over.
+ * @remarks Other handles of the bus can use it between the pages.
+ * @remarks The I2C adapter must support #PERIPHERAL_I2C_TRANSFER_PATH_I2C.
+ *
+ * @param[in] i2c The I2C handle of the EEPROM
+ * @param[in] width The width of the memory addresses of the EEPROM
+ * @param[in] page_size The size of the pages of the EEPROM (in bytes, 1 ~ 4096)
+ * @param[in] offset The memory address to start writing at
+ * @param[in] data The data buffer to write
+ * @param[in] length The size of data buffer (in bytes), @a offset + @a length must fit in the memory addresses of @a width
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_TRY_AGAIN The EEPROM did not finish a write cycle in time
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @pre peripheral_i2c_open()
+ * @see peripheral_i2c_eeprom_read()
  */
-int peripheral_i2c_close(peripheral_i2c_h i2c);
+int peripheral_i2c_eeprom_write(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t page_size, uint32_t offset, uint8_t *data, uint32_t length);
 
 /**
  * @platform
- * @brief Reads the bytes data from the I2C slave device.
- * @since_tizen 4.0
+ * @brief Reads a range of an I2C EEPROM with sequential reads.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The range is read in reads of up to 8192 bytes, several of them in one combined transfer.
+ * @remarks The I2C adapter must support #PERIPHERAL_I2C_TRANSFER_PATH_I2C.
  *
- * @param[in] i2c The I2C handle
+ * @param[in] i2c The I2C handle of the EEPROM
+ * @param[in] width The width of the memory addresses of the EEPROM
+ * @param[in] offset The memory address to start reading at
  * @param[out] data The data buffer to read
- * @param[in] length The size of data buffer (in bytes)
+ * @param[in] length The size of data buffer (in bytes), @a offset + @a length must fit in the memory addresses of @a width
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
@@ -378,126 +1910,141 @@ int peripheral_i2c_close(peripheral_i2c_h i2c);
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @see peripheral_i2c_write()
+ * @see peripheral_i2c_eeprom_write()
  */
-int peripheral_i2c_read(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
+int peripheral_i2c_eeprom_read(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t offset, uint8_t *data, uint32_t length);
+
+/**
+ * @brief Enumeration of the byte orders of the 16-bit registers of I2C slave devices.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_I2C_ENDIAN_LITTLE = 0, /**< Least significant byte first, as SMBus words */
+	PERIPHERAL_I2C_ENDIAN_BIG,        /**< Most significant byte first */
+} peripheral_i2c_endian_e;
 
 /**
  * @platform
- * @brief Writes the bytes data to the I2C slave device.
- * @since_tizen 4.0
+ * @brief Sets the register address width and the word byte order of the I2C slave device.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks They apply to peripheral_i2c_read_register_u16(), peripheral_i2c_write_register_u16() and their array variants. The default is 8-bit addresses and little-endian words.
  *
  * @param[in] i2c The I2C handle
- * @param[in] data The data buffer to write
- * @param[in] length The size of data buffer (in bytes)
+ * @param[in] width The width of the register addresses
+ * @param[in] endian The byte order of the 16-bit registers
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
- * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
- *
- * @see peripheral_i2c_read()
  */
-int peripheral_i2c_write(peripheral_i2c_h i2c, uint8_t *data, uint32_t length);
+int peripheral_i2c_set_register_format(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, peripheral_i2c_endian_e endian);
 
 /**
  * @platform
- * @brief Reads single byte data from the register of the I2C slave device.
- * @since_tizen 4.0
+ * @brief Reads a 16-bit register of the I2C slave device.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The register address and the byte order of the words are set with peripheral_i2c_set_register_format().
+ * @remarks The address and the data are sent in one combined transfer. 16-bit register addresses need #PERIPHERAL_I2C_TRANSFER_PATH_I2C.
  *
  * @param[in] i2c The I2C handle
- * @param[in] reg The register address of the I2C slave device to read
- * @param[out] data The single byte data to read
+ * @param[in] reg The address of the register
+ * @param[out] data The value of the register, in host byte order
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @see peripheral_i2c_write_register_byte()
+ * @see peripheral_i2c_read_register_u16_array()
  */
-int peripheral_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data);
+int peripheral_i2c_read_register_u16(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data);
 
 /**
  * @platform
- * @brief Writes single byte data to the register of the I2C slave device.
- * @since_tizen 4.0
+ * @brief Writes a 16-bit register of the I2C slave device.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The register address and the byte order of the words are set with peripheral_i2c_set_register_format().
+ * @remarks 16-bit register addresses need #PERIPHERAL_I2C_TRANSFER_PATH_I2C.
  *
  * @param[in] i2c The I2C handle
- * @param[in] reg The register address of the I2C slave device to write
- * @param[in] data The single byte data to write
+ * @param[in] reg The address of the register
+ * @param[in] data The value to write, in host byte order
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @see peripheral_i2c_read_register_byte()
+ * @see peripheral_i2c_write_register_u16_array()
  */
-int peripheral_i2c_write_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t data);
+int peripheral_i2c_write_register_u16(peripheral_i2c_h i2c, uint16_t reg, uint16_t data);
 
 /**
  * @platform
- * @brief Reads word data from the register of the I2C slave device.
- * @since_tizen 4.0
+ * @brief Reads consecutive 16-bit registers of the I2C slave device.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The register address and the byte order of the words are set with peripheral_i2c_set_register_format().
+ * @remarks The block is read in one combined transfer and converted to host byte order in one pass.
  *
  * @param[in] i2c The I2C handle
- * @param[in] reg The register address of the I2C slave device to read
- * @param[out] data The word(2 bytes) data to read
+ * @param[in] reg The address of the first register
+ * @param[out] data The array to store the values, in host byte order
+ * @param[in] count The number of registers to read (1 ~ 4096)
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @see peripheral_i2c_write_register_word()
+ * @see peripheral_i2c_read_register_u16()
  */
-int peripheral_i2c_read_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t *data);
+int peripheral_i2c_read_register_u16_array(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data, uint32_t count);
 
 /**
  * @platform
- * @brief Writes word data to the register of the I2C slave device.
- * @since_tizen 4.0
+ * @brief Writes consecutive 16-bit registers of the I2C slave device.
+ * @since_tizen 5.0
  * @privlevel platform
  * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The register address and the byte order of the words are set with peripheral_i2c_set_register_format().
+ * @remarks The block is converted from host byte order in one pass and written in one transfer.
  *
  * @param[in] i2c The I2C handle
- * @param[in] reg The register address of the I2C slave device to write
- * @param[in] data The word(2 bytes) data to write
+ * @param[in] reg The address of the first register
+ * @param[in] data The array of the values to write, in host byte order
+ * @param[in] count The number of registers to write (1 ~ 4095)
  *
  * @return 0 on success, otherwise a negative error value
  * @retval #PERIPHERAL_ERROR_NONE Successful
  * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
  * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
  * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
  * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
- * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
  *
- * @see peripheral_i2c_read_register_word()
+ * @see peripheral_i2c_write_register_u16()
  */
-int peripheral_i2c_write_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16_t data);
+int peripheral_i2c_write_register_u16_array(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data, uint32_t count);
 
 /**
 * @}
@@ -1081,6 +2628,16 @@ typedef enum {
 	PERIPHERAL_SPI_BIT_ORDER_LSB,     /**< Use least significant bit first */
 } peripheral_spi_bit_order_e;
 
+/**
+ * @brief Enumeration of SPI bus widths.
+ * @since_tizen 5.0
+ */
+typedef enum {
+	PERIPHERAL_SPI_BUS_WIDTH_SINGLE = 1, /**< One data line */
+	PERIPHERAL_SPI_BUS_WIDTH_DUAL = 2,   /**< Two data lines */
+	PERIPHERAL_SPI_BUS_WIDTH_QUAD = 4,   /**< Four data lines */
+} peripheral_spi_bus_width_e;
+
 /**
  * @platform
  * @brief Opens a SPI slave device.
@@ -1198,6 +2755,34 @@ int peripheral_spi_set_bit_order(peripheral_spi_h spi, peripheral_spi_bit_order_
  */
 int peripheral_spi_set_bits_per_word(peripheral_spi_h spi, uint8_t bits);
 
+/**
+ * @platform
+ * @brief Sets the number of data lines the SPI slave device uses to write and to read.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The widths apply to the following transfers of the handle, and to the segments of peripheral_spi_transfer_segments() not giving their own.
+ * @remarks The segments may give narrower widths than the handle, but not wider ones.
+ * @remarks The widths are single until this function is called, even when the device allows wider ones.
+ * @remarks #PERIPHERAL_ERROR_NOT_SUPPORTED is returned when the controller does not support the widths, and the widths of the handle are left as they were.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] tx_width The bus width to write
+ * @param[in] rx_width The bus width to read
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_spi_bus_width_e
+ */
+int peripheral_spi_set_bus_width(peripheral_spi_h spi, peripheral_spi_bus_width_e tx_width, peripheral_spi_bus_width_e rx_width);
+
 /**
  * @platform
  * @brief Sets the frequency of the SPI bus.
@@ -1294,6 +2879,258 @@ int peripheral_spi_write(peripheral_spi_h spi, uint8_t *data, uint32_t length);
  */
 int peripheral_spi_transfer(peripheral_spi_h spi, uint8_t *txdata, uint8_t *rxdata, uint32_t length);
 
+/**
+ * @platform
+ * @brief Exchanges the bytes data with the SPI slave device at a given frequency and word size.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The frequency and the word size only apply to this call, they are sent along with the data and the settings of the handle are not changed. This suits devices of different speeds sharing one handle.
+ * @remarks peripheral_spi_set_frequency(), peripheral_spi_set_mode(), peripheral_spi_set_bit_order() and peripheral_spi_set_bits_per_word() do not access the device when the value is already set.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] txdata The data buffer to write, NULL to write zeros
+ * @param[out] rxdata The data buffer to read, NULL to discard the data read
+ * @param[in] length The size of txdata and rxdata buffer (in bytes)
+ * @param[in] speed_hz The frequency of the transfer, 0 for the frequency of the handle
+ * @param[in] bits_per_word The word size of the transfer, 0 for the word size of the handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_spi_transfer()
+ */
+int peripheral_spi_transfer_with_settings(peripheral_spi_h spi, uint8_t *txdata, uint8_t *rxdata, uint32_t length, uint32_t speed_hz, uint8_t bits_per_word);
+
+/**
+ * @brief The structure of a segment of a SPI message.
+ * @since_tizen 5.0
+ */
+typedef struct {
+	uint8_t *txdata;       /**< The data buffer to write, NULL to write zeros */
+	uint8_t *rxdata;       /**< The data buffer to read, NULL to discard the data read */
+	uint32_t length;       /**< The size of the buffers (in bytes) */
+	uint32_t speed_hz;     /**< The frequency of the segment, 0 for the frequency of the handle */
+	uint16_t delay_usecs;  /**< The delay after the segment, before the next one or the end of the message (in microseconds) */
+	uint8_t bits_per_word; /**< The word size of the segment, 0 for the word size of the handle */
+	bool cs_change;        /**< Deselects the chip after the segment, or keeps it selected after the last one */
+	uint8_t tx_nbits;      /**< The bus width to write the segment (#peripheral_spi_bus_width_e), 0 for the width of the handle */
+	uint8_t rx_nbits;      /**< The bus width to read the segment (#peripheral_spi_bus_width_e), 0 for the width of the handle */
+} peripheral_spi_segment_s;
+
+/**
+ * @platform
+ * @brief Exchanges several segments of data with the SPI slave device in one message.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The chip stays selected from the first segment to the last one, unless @a cs_change of a segment says otherwise, so for example a command and its reply are one exchange.
+ * @remarks All segments are submitted in one system call.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] segments The array of segments, in the order they are exchanged
+ * @param[in] count The number of segments (1 ~ 511)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_NO_DEVICE Device does not exist or is removed
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ * @retval #PERIPHERAL_ERROR_UNKNOWN Unknown internal error
+ *
+ * @see peripheral_spi_segment_s
+ * @see peripheral_spi_transfer()
+ */
+int peripheral_spi_transfer_segments(peripheral_spi_h spi, peripheral_spi_segment_s *segments, int count);
+
+/**
+ * @platform
+ * @brief Sets whether the chip stays selected between the chunks of a long SPI transfer.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks peripheral_spi_read(), peripheral_spi_write() and peripheral_spi_transfer() split the data longer than the transfer limit of the system in chunks, each sent in its own message.
+ * @remarks By default the chip is deselected between the chunks. When @a hold is true, it stays selected from the first chunk to the end of the last one, which devices expecting one long transfer need. Other devices of the bus must not be used meanwhile.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] hold true to keep the chip selected between the chunks, otherwise false
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_get_max_transfer_size()
+ */
+int peripheral_spi_set_chunk_cs_hold(peripheral_spi_h spi, bool hold);
+
+/**
+ * @platform
+ * @brief Gets the largest SPI transfer the system takes in one message.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The size is the bufsiz of spidev when the handle is opened, 4096 bytes when it is unknown. It is lowered when the controller refuses chunks of that size.
+ * @remarks The total length of the segments given to peripheral_spi_transfer_segments() must not exceed it.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[out] size The largest transfer (in bytes)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_set_chunk_cs_hold()
+ */
+int peripheral_spi_get_max_transfer_size(peripheral_spi_h spi, uint32_t *size);
+
+/**
+ * @platform
+ * @brief Called when a block of a SPI stream is filled.
+ * @since_tizen 5.0
+ * @remarks @a data is valid only in the callback. The stream does not transfer the next block until the callback returns.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] data The data read in the block
+ * @param[in] length The length of the block (in bytes)
+ * @param[in] user_data The user data passed from peripheral_spi_start_stream()
+ *
+ * @see peripheral_spi_start_stream()
+ */
+typedef void(*peripheral_spi_stream_cb)(peripheral_spi_h spi, const uint8_t *data, uint32_t length, void *user_data);
+
+/**
+ * @platform
+ * @brief Starts reading the SPI slave device continuously.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks A thread of the library transfers blocks back to back. A block is @a frames frames of @a frame_size bytes, sent in one message with the chip deselected between the frames. @a txdata is written in every frame.
+ * @remarks When @a callback is given, every block is passed to it. Otherwise the blocks are kept in a ring of @a count buffers, read by peripheral_spi_read_stream(), and the fd from peripheral_spi_get_stream_fd() becomes readable when one is filled.
+ * @remarks The ring holds @a count buffers rounded up to the next power of two. When the ring is full, the blocks are still transferred but dropped, and counted by peripheral_spi_get_stream_overruns().
+ * @remarks The handle must not be used for other transfers until the stream is stopped by peripheral_spi_stop_stream() or peripheral_spi_close().
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[in] txdata The data written in every frame, or NULL to write zeros
+ * @param[in] frame_size The length of a frame (in bytes)
+ * @param[in] frames The number of frames in a block, up to 511
+ * @param[in] count The number of buffers of the ring, at least 2, rounded up to a power of two
+ * @param[in] callback The callback called with the blocks, or NULL to use the ring
+ * @param[in] user_data The user data to be passed to the callback
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_IO_ERROR I/O operation failed
+ * @retval #PERIPHERAL_ERROR_OUT_OF_MEMORY Memory allocation failed
+ * @retval #PERIPHERAL_ERROR_RESOURCE_BUSY Stream is already running
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @pre The block (@a frame_size x @a frames) must not exceed the size from peripheral_spi_get_max_transfer_size().
+ * @see peripheral_spi_stop_stream()
+ */
+int peripheral_spi_start_stream(peripheral_spi_h spi, uint8_t *txdata, uint32_t frame_size, int frames, int count, peripheral_spi_stream_cb callback, void *user_data);
+
+/**
+ * @platform
+ * @brief Stops the stream of the SPI slave device.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The blocks not read yet are discarded.
+ *
+ * @param[in] spi The SPI slave device handle
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_IO_ERROR The stream was stopped by a failed transfer
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_start_stream()
+ */
+int peripheral_spi_stop_stream(peripheral_spi_h spi);
+
+/**
+ * @platform
+ * @brief Gets the file descriptor signaled when a block of the SPI stream is filled.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The fd is an eventfd counting the filled blocks. It is valid until the stream is stopped and must not be closed.
+ * @remarks The fd exists only when the stream is started without a callback.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[out] fd The file descriptor
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_read_stream()
+ */
+int peripheral_spi_get_stream_fd(peripheral_spi_h spi, int *fd);
+
+/**
+ * @platform
+ * @brief Reads the oldest filled block of the SPI stream.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ * @remarks The function does not block. The buffer of the block is given back to the stream.
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[out] data The block read
+ * @param[in] length The size of @a data, at least the size of a block (in bytes)
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_TRY_AGAIN No block is filled
+ * @retval #PERIPHERAL_ERROR_IO_ERROR The stream was stopped by a failed transfer
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_get_stream_fd()
+ */
+int peripheral_spi_read_stream(peripheral_spi_h spi, uint8_t *data, uint32_t length);
+
+/**
+ * @platform
+ * @brief Gets the number of blocks of the SPI stream dropped because the ring was full.
+ * @since_tizen 5.0
+ * @privlevel platform
+ * @privilege http://tizen.org/privilege/peripheralio
+ *
+ * @param[in] spi The SPI slave device handle
+ * @param[out] overruns The number of dropped blocks since the stream was started
+ *
+ * @return 0 on success, otherwise a negative error value
+ * @retval #PERIPHERAL_ERROR_NONE Successful
+ * @retval #PERIPHERAL_ERROR_PERMISSION_DENIED Permission denied
+ * @retval #PERIPHERAL_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval #PERIPHERAL_ERROR_NOT_SUPPORTED Not supported
+ *
+ * @see peripheral_spi_start_stream()
+ */
+int peripheral_spi_get_stream_overruns(peripheral_spi_h spi, uint32_t *overruns);
+
 /**
 * @}
 */
@@ -14,12 +14,300 @@
  * limitations under the License.
  */
 
+#include <fcntl.h>
+#include <limits.h>
+#include <dirent.h>
+#include <sys/ioctl.h>
+#include <sys/epoll.h>
 #include <poll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <linux/gpio.h>
 #include "peripheral_interface_gpio.h"
 
 #define GPIO_INTERRUPTED_CALLBACK_UNSET 0
 #define GPIO_INTERRUPTED_CALLBACK_SET   1
 
+#define GPIO_SYSFS_CLASS_PATH "/sys/class/gpio"
+#define GPIO_CHARDEV_DIR_PATH "/dev"
+#define GPIO_CHARDEV_CONSUMER "peripheral-io"
+#define GPIO_CHARDEV_EVENT_BUFFER_SIZE 256
+
+#define GPIO_DISPATCHER_EVENTS_MAX 16
+#define GPIO_DISPATCHER_WAKEUP_ID  0
+
+#define GPIO_WAVEFORM_PRIORITY 50
+
+/*
+ * A single dispatcher thread watches the value fds of all handles with an interrupted
+ * callback in one epoll set. Handles are looked up by id, never by the pointer stored
+ * in the epoll event, so that an edge reported after unregistering is simply dropped.
+ * The thread blocks without timeout; stopping it is signalled through the eventfd.
+ * The lock is recursive because callbacks delivered directly run with it held and may
+ * unset themselves or close their handle.
+ */
+typedef struct {
+	GThread *thread;
+	int epoll_fd;
+	int event_fd;
+	gboolean stop;
+	gboolean detached;
+} gpio_dispatcher_s;
+
+static GRecMutex dispatcher_lock;
+static gpio_dispatcher_s *dispatcher = NULL;
+static GHashTable *dispatcher_handles = NULL;
+static guint dispatcher_next_id = 0;
+static guint dispatcher_pending = 0;
+
+static int __gpio_read_sysfs_int(const char *dir, const char *attr, int *value)
+{
+	FILE *fp;
+	char path[PATH_MAX];
+
+	snprintf(path, sizeof(path), "%s/%s/%s", GPIO_SYSFS_CLASS_PATH, dir, attr);
+
+	fp = fopen(path, "r");
+	if (fp == NULL)
+		return PERIPHERAL_ERROR_IO_ERROR;
+
+	if (fscanf(fp, "%d", value) != 1) {
+		fclose(fp);
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	fclose(fp);
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static int __gpio_read_sysfs_label(const char *dir, char *label, size_t len)
+{
+	FILE *fp;
+	char path[PATH_MAX];
+
+	snprintf(path, sizeof(path), "%s/%s/label", GPIO_SYSFS_CLASS_PATH, dir);
+
+	fp = fopen(path, "r");
+	if (fp == NULL)
+		return PERIPHERAL_ERROR_IO_ERROR;
+
+	if (fgets(label, len, fp) == NULL) {
+		fclose(fp);
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	label[strcspn(label, "\n")] = '\0';
+
+	fclose(fp);
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * A parent device may register several banks, so the chardev is the one whose
+ * label and number of lines match the sysfs chip. When that is not unique, the chip
+ * cannot be told apart and the pin is left to the sysfs path.
+ */
+static int __gpio_chardev_match_chip(const char *label, int ngpio, char *chip_path, size_t len)
+{
+	DIR *dev_dir;
+	struct dirent *entry;
+	struct gpiochip_info info;
+	char path[PATH_MAX];
+	int matches = 0;
+	int fd;
+	int ret;
+
+	dev_dir = opendir(GPIO_CHARDEV_DIR_PATH);
+	if (dev_dir == NULL)
+		return PERIPHERAL_ERROR_NO_DEVICE;
+
+	while ((entry = readdir(dev_dir)) != NULL) {
+		if (strncmp(entry->d_name, "gpiochip", 8))
+			continue;
+
+		snprintf(path, sizeof(path), "%s/%s", GPIO_CHARDEV_DIR_PATH, entry->d_name);
+
+		fd = open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			continue;
+
+		memset(&info, 0, sizeof(info));
+		ret = ioctl(fd, GPIO_GET_CHIPINFO_IOCTL, &info);
+		close(fd);
+
+		if (ret < 0 || info.lines != (uint32_t)ngpio || strncmp(info.label, label, sizeof(info.label)))
+			continue;
+
+		snprintf(chip_path, len, "%s", path);
+		matches++;
+	}
+
+	closedir(dev_dir);
+
+	if (matches != 1) {
+		_D("%d gpio chardevs match the chip %s, using sysfs", matches, label);
+		return PERIPHERAL_ERROR_NO_DEVICE;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * The global pin number is resolved through the gpiochip entries of the sysfs class,
+ * whose base and ngpio give the pin range, and the chip is then matched to its chardev.
+ */
+static int __gpio_chardev_find_line(int pin, char *chip_path, size_t len, uint32_t *offset)
+{
+	DIR *class_dir;
+	struct dirent *entry;
+	char label[GPIO_MAX_NAME_SIZE];
+	int base;
+	int ngpio;
+	int ret = PERIPHERAL_ERROR_NO_DEVICE;
+
+	class_dir = opendir(GPIO_SYSFS_CLASS_PATH);
+	if (class_dir == NULL)
+		return PERIPHERAL_ERROR_NO_DEVICE;
+
+	while ((entry = readdir(class_dir)) != NULL) {
+		if (strncmp(entry->d_name, "gpiochip", 8))
+			continue;
+
+		if (__gpio_read_sysfs_int(entry->d_name, "base", &base) != PERIPHERAL_ERROR_NONE ||
+			__gpio_read_sysfs_int(entry->d_name, "ngpio", &ngpio) != PERIPHERAL_ERROR_NONE)
+			continue;
+
+		if (pin < base || pin >= base + ngpio)
+			continue;
+
+		if (__gpio_read_sysfs_label(entry->d_name, label, sizeof(label)) != PERIPHERAL_ERROR_NONE)
+			break;
+
+		ret = __gpio_chardev_match_chip(label, ngpio, chip_path, len);
+		if (ret == PERIPHERAL_ERROR_NONE)
+			*offset = (uint32_t)(pin - base);
+		break;
+	}
+
+	closedir(class_dir);
+
+	return ret;
+}
+
+static int __gpio_chardev_set_config(peripheral_gpio_h gpio, peripheral_gpio_direction_e direction, peripheral_gpio_edge_e edge)
+{
+	int ret;
+	struct gpio_v2_line_config config;
+
+	memset(&config, 0, sizeof(config));
+
+	if (direction == PERIPHERAL_GPIO_DIRECTION_IN) {
+		config.flags = GPIO_V2_LINE_FLAG_INPUT;
+		if (edge == PERIPHERAL_GPIO_EDGE_RISING || edge == PERIPHERAL_GPIO_EDGE_BOTH)
+			config.flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;
+		if (edge == PERIPHERAL_GPIO_EDGE_FALLING || edge == PERIPHERAL_GPIO_EDGE_BOTH)
+			config.flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;
+		if (gpio->debounce.stable_us > 0 && !gpio->debounce.software) {
+			config.num_attrs = 1;
+			config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_DEBOUNCE;
+			config.attrs[0].attr.debounce_period_us = gpio->debounce.stable_us;
+			config.attrs[0].mask = 1;
+		}
+	} else {
+		config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+		config.num_attrs = 1;
+		config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+		config.attrs[0].attr.values = (direction == PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_HIGH) ? 1 : 0;
+		config.attrs[0].mask = 1;
+	}
+
+	ret = ioctl(gpio->fd_line, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config);
+	if (ret < 0 && direction == PERIPHERAL_GPIO_DIRECTION_IN && config.num_attrs > 0) {
+		/* The line does not accept the kernel debounce, the stable time is checked in software instead */
+		_D("gpio line does not support debounce, falling back to software");
+		gpio->debounce.software = true;
+		config.num_attrs = 0;
+		ret = ioctl(gpio->fd_line, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config);
+	}
+	CHECK_ERROR(ret < 0);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static int __gpio_chardev_read(peripheral_gpio_h gpio, uint32_t *value)
+{
+	int ret;
+	struct gpio_v2_line_values values = {
+		.bits = 0,
+		.mask = 1,
+	};
+
+	ret = ioctl(gpio->fd_line, GPIO_V2_LINE_GET_VALUES_IOCTL, &values);
+	CHECK_ERROR(ret < 0);
+
+	*value = (uint32_t)(values.bits & 1);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * The line is requested "as-is" so that the current direction is kept,
+ * as it is when the pin is opened through sysfs.
+ */
+int peripheral_interface_gpio_open_chardev(peripheral_gpio_h gpio, int pin)
+{
+	int ret;
+	int fd_chip;
+	uint32_t offset;
+	uint32_t value = 0;
+	char chip_path[PATH_MAX];
+	struct gpio_v2_line_info info;
+	struct gpio_v2_line_request request;
+
+	ret = __gpio_chardev_find_line(pin, chip_path, sizeof(chip_path), &offset);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	fd_chip = open(chip_path, O_RDWR | O_CLOEXEC);
+	CHECK_ERROR(fd_chip < 0);
+
+	memset(&info, 0, sizeof(info));
+	info.offset = offset;
+
+	ret = ioctl(fd_chip, GPIO_V2_GET_LINEINFO_IOCTL, &info);
+	if (ret == 0) {
+		memset(&request, 0, sizeof(request));
+		request.offsets[0] = offset;
+		request.num_lines = 1;
+		request.event_buffer_size = GPIO_CHARDEV_EVENT_BUFFER_SIZE;
+		strncpy(request.consumer, GPIO_CHARDEV_CONSUMER, sizeof(request.consumer) - 1);
+
+		ret = ioctl(fd_chip, GPIO_V2_GET_LINE_IOCTL, &request);
+	}
+
+	close(fd_chip);
+	CHECK_ERROR(ret < 0);
+
+	gpio->fd_line = request.fd;
+	gpio->edge = PERIPHERAL_GPIO_EDGE_NONE;
+	gpio->direction = PERIPHERAL_GPIO_DIRECTION_IN;
+
+	if (info.flags & GPIO_V2_LINE_FLAG_OUTPUT) {
+		ret = __gpio_chardev_read(gpio, &value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			close(gpio->fd_line);
+			return ret;
+		}
+		gpio->direction = value ? PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_HIGH : PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW;
+	}
+
+	gpio->backend = GPIO_BACKEND_CHARDEV;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
 int peripheral_interface_gpio_set_initial_direction_into_handle(peripheral_gpio_h gpio)
 {
 	static predefined_type_s types[2] = {
@@ -64,7 +352,18 @@ int peripheral_interface_gpio_set_direction(peripheral_gpio_h gpio, peripheral_g
 		{"low",  3}
 	};
 
-	int ret = write(gpio->fd_direction, types[direction].type, types[direction].len);
+	int ret;
+
+	if (gpio->backend == GPIO_BACKEND_CHARDEV) {
+		ret = __gpio_chardev_set_config(gpio, direction, gpio->edge);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		gpio->direction = direction;
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	ret = write(gpio->fd_direction, types[direction].type, types[direction].len);
 	CHECK_ERROR(ret != types[direction].len);
 
 	gpio->direction = direction;
@@ -110,6 +409,7 @@ int peripheral_interface_gpio_set_edge_mode(peripheral_gpio_h gpio, peripheral_g
 {
 	RETV_IF(gpio->edge == edge, PERIPHERAL_ERROR_NONE);
 	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+	RETVM_IF(gpio->capture != NULL && edge != PERIPHERAL_GPIO_EDGE_BOTH, PERIPHERAL_ERROR_RESOURCE_BUSY, "gpio pulse capture needs both edges");
 
 	static predefined_type_s types[4] = {
 		{"none",    4},
@@ -118,7 +418,18 @@ int peripheral_interface_gpio_set_edge_mode(peripheral_gpio_h gpio, peripheral_g
 		{"both",    4}
 	};
 
-	int ret = write(gpio->fd_edge, types[edge].type, types[edge].len);
+	int ret;
+
+	if (gpio->backend == GPIO_BACKEND_CHARDEV) {
+		ret = __gpio_chardev_set_config(gpio, gpio->direction, edge);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		gpio->edge = edge;
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	ret = write(gpio->fd_edge, types[edge].type, types[edge].len);
 	CHECK_ERROR(ret != types[edge].len);
 
 	gpio->edge = edge;
@@ -141,7 +452,21 @@ int peripheral_interface_gpio_write(peripheral_gpio_h gpio, uint32_t value)
 		{"1", 1}
 	};
 
-	int ret = write(gpio->fd_value, types[value].type, types[value].len);
+	int ret;
+
+	if (gpio->backend == GPIO_BACKEND_CHARDEV) {
+		struct gpio_v2_line_values values = {
+			.bits = value,
+			.mask = 1,
+		};
+
+		ret = ioctl(gpio->fd_line, GPIO_V2_LINE_SET_VALUES_IOCTL, &values);
+		CHECK_ERROR(ret < 0);
+
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	ret = write(gpio->fd_value, types[value].type, types[value].len);
 	CHECK_ERROR(ret != types[value].len);
 
 	return PERIPHERAL_ERROR_NONE;
@@ -159,6 +484,9 @@ int peripheral_interface_gpio_read(peripheral_gpio_h gpio, uint32_t *value)
 	int length = 1;
 	char gpio_buf[GPIO_BUFFER_MAX] = {0, };
 
+	if (gpio->backend == GPIO_BACKEND_CHARDEV)
+		return __gpio_chardev_read(gpio, value);
+
 	lseek(gpio->fd_value, 0, SEEK_SET);
 	ret = read(gpio->fd_value, &gpio_buf, length);
 	CHECK_ERROR(ret != length);
@@ -178,6 +506,15 @@ int peripheral_interface_gpio_read(peripheral_gpio_h gpio, uint32_t *value)
 void peripheral_interface_gpio_close(peripheral_gpio_h gpio)
 {
 	peripheral_interface_gpio_unset_interrupted_cb(gpio);
+	peripheral_interface_gpio_unset_event_queue(gpio);
+	peripheral_interface_gpio_unset_edge_counter(gpio);
+	peripheral_interface_gpio_unset_pulse_capture(gpio);
+	peripheral_interface_gpio_set_interrupted_cb_delivery(gpio, PERIPHERAL_GPIO_CALLBACK_DELIVERY_MAIN_LOOP, NULL);
+
+	if (gpio->backend == GPIO_BACKEND_CHARDEV) {
+		close(gpio->fd_line);
+		return;
+	}
 
 	close(gpio->fd_direction);
 	close(gpio->fd_edge);
@@ -191,79 +528,1329 @@ static gboolean __peripheral_interface_gpio_interrupted_cb_invoke(gpointer data)
 	return FALSE;
 }
 
-static gpointer __peripheral_interface_gpio_poll(void *data)
+/*
+ * Must be called with dispatcher_lock held.
+ */
+static void __peripheral_interface_gpio_interrupted_cb_deliver(peripheral_gpio_h gpio, peripheral_error_e error)
 {
-	peripheral_gpio_h gpio = (peripheral_gpio_h)data;
+	GSource *source;
 
-	int ret;
-	int poll_state = 0;
-	struct pollfd poll_fd;
+	gpio->cb_info.error = error;
+
+	if (gpio->cb_info.delivery == PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT) {
+		gpio->cb_info.cb(gpio, error, gpio->cb_info.user_data);
+		return;
+	}
+
+	if (gpio->cb_info.context == NULL) {
+		g_idle_add_full(G_PRIORITY_HIGH_IDLE, __peripheral_interface_gpio_interrupted_cb_invoke, gpio, NULL);
+		return;
+	}
 
-	poll_fd.fd = gpio->fd_value;
-	poll_fd.events = POLLPRI;
+	source = g_idle_source_new();
+	g_source_set_priority(source, G_PRIORITY_HIGH_IDLE);
+	g_source_set_callback(source, __peripheral_interface_gpio_interrupted_cb_invoke, gpio, NULL);
+	g_source_attach(source, gpio->cb_info.context);
+	g_source_unref(source);
+}
 
+/*
+ * On the chardev backend each edge is queued by the kernel as a line event with its
+ * timestamp, so the value is taken from the event instead of being read back.
+ * On sysfs the value is read back and the edge is stamped when it is handled.
+ */
+static int __peripheral_interface_gpio_read_edges(peripheral_gpio_h gpio, peripheral_gpio_event_s *edges, int max)
+{
+	int ret;
+	int index;
+	int count;
 	uint32_t value;
+	struct timespec now;
+	struct gpio_v2_line_event events[GPIO_DISPATCHER_EVENTS_MAX];
 
-	while (g_atomic_int_get(&gpio->cb_info.status) == GPIO_INTERRUPTED_CALLBACK_SET) {
+	if (gpio->backend != GPIO_BACKEND_CHARDEV) {
+		ret = peripheral_interface_gpio_read(gpio, &value);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
 
-		poll_state = poll(&poll_fd, 1, 3000);
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		edges[0].timestamp = (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+		edges[0].value = value;
+		edges[0].seqno = ++gpio->seqno;
+		return 1;
+	}
 
-		if (poll_state == 0)
-			continue;
+	ret = read(gpio->fd_line, events, sizeof(struct gpio_v2_line_event) * MIN(max, GPIO_DISPATCHER_EVENTS_MAX));
+	CHECK_ERROR(ret <= 0);
 
-		if (poll_state < 0) {
-			_E("poll failed!");
-			gpio->cb_info.error = PERIPHERAL_ERROR_IO_ERROR;
-			g_idle_add_full(G_PRIORITY_HIGH_IDLE, __peripheral_interface_gpio_interrupted_cb_invoke, gpio, NULL);
-			break;
+	count = ret / sizeof(struct gpio_v2_line_event);
+	for (index = 0; index < count; index++) {
+		edges[index].timestamp = events[index].timestamp_ns;
+		edges[index].value = (events[index].id == GPIO_V2_LINE_EVENT_RISING_EDGE) ? 1 : 0;
+		edges[index].seqno = events[index].line_seqno;
+	}
+
+	return count;
+}
+
+/*
+ * Single producer side of the event queue, called from the dispatcher thread only.
+ * When the queue is full the edge is dropped, which shows up as a gap in seqno.
+ */
+static void __peripheral_interface_gpio_event_queue_push(gpio_event_queue_s *queue, peripheral_gpio_event_s *edge)
+{
+	guint head = (guint)g_atomic_int_get(&queue->head);
+	guint tail = (guint)g_atomic_int_get(&queue->tail);
+
+	if (head - tail >= queue->size)
+		return;
+
+	queue->events[head & (queue->size - 1)] = *edge;
+	g_atomic_int_set(&queue->head, (gint)(head + 1));
+}
+
+/*
+ * Single producer side of the pulse capture, called from the dispatcher thread only.
+ * A pulse is measured from a rising edge to the next one. Two edges of the same value
+ * in a row mean that an edge was lost, so the measurement in progress is discarded.
+ */
+static void __peripheral_interface_gpio_pulse_capture_push(gpio_pulse_capture_s *capture, peripheral_gpio_event_s *edge)
+{
+	guint head;
+	guint tail;
+	peripheral_gpio_pulse_s *pulse;
+
+	if (edge->value == 0) {
+		if (capture->state == GPIO_PULSE_CAPTURE_HIGH) {
+			capture->fall = edge->timestamp;
+			capture->state = GPIO_PULSE_CAPTURE_LOW;
+		} else {
+			capture->state = GPIO_PULSE_CAPTURE_IDLE;
 		}
+		return;
+	}
 
-		if (poll_fd.revents & POLLPRI) {
-			ret = peripheral_interface_gpio_read(gpio, &value);
-			if (ret != PERIPHERAL_ERROR_NONE)
+	if (capture->state == GPIO_PULSE_CAPTURE_LOW) {
+		head = (guint)g_atomic_int_get(&capture->head);
+		tail = (guint)g_atomic_int_get(&capture->tail);
+
+		if (head - tail < capture->size) {
+			pulse = &capture->pulses[head & (capture->size - 1)];
+			pulse->timestamp = edge->timestamp;
+			pulse->high_time = capture->fall - capture->rise;
+			pulse->low_time = edge->timestamp - capture->fall;
+			pulse->period = edge->timestamp - capture->rise;
+			g_atomic_int_set(&capture->head, (gint)(head + 1));
+		}
+	}
+
+	capture->rise = edge->timestamp;
+	capture->state = GPIO_PULSE_CAPTURE_HIGH;
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Moves the sliding window of the edge counter forward to the slot containing now.
+ */
+static void __peripheral_interface_gpio_counter_advance(gpio_edge_counter_s *counter, uint64_t now)
+{
+	uint64_t elapsed;
+
+	if (now < counter->slot_start + counter->slot_ns)
+		return;
+
+	elapsed = (now - counter->slot_start) / counter->slot_ns;
+	if (elapsed >= GPIO_COUNTER_SLOTS) {
+		memset(counter->slots, 0, sizeof(counter->slots));
+		counter->slot = 0;
+	} else {
+		while (elapsed-- > 0) {
+			counter->slot = (counter->slot + 1) % GPIO_COUNTER_SLOTS;
+			counter->slots[counter->slot] = 0;
+		}
+	}
+
+	counter->slot_start = now - (now - counter->slot_start) % counter->slot_ns;
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Returns false when a callback delivered directly has unregistered or even closed the handle.
+ */
+static bool __peripheral_interface_gpio_report_edge(peripheral_gpio_h gpio, guint id, peripheral_gpio_event_s *edge)
+{
+	if (gpio->edge == PERIPHERAL_GPIO_EDGE_NONE)
+		return true;
+
+	if (gpio->edge == PERIPHERAL_GPIO_EDGE_RISING && edge->value == 0)
+		return true;
+
+	if (gpio->edge == PERIPHERAL_GPIO_EDGE_FALLING && edge->value == 1)
+		return true;
+
+	if (gpio->counter != NULL) {
+		__peripheral_interface_gpio_counter_advance(gpio->counter, edge->timestamp);
+		gpio->counter->slots[gpio->counter->slot]++;
+		gpio->counter->total++;
+	}
+
+	if (gpio->queue != NULL)
+		__peripheral_interface_gpio_event_queue_push(gpio->queue, edge);
+
+	if (gpio->capture != NULL)
+		__peripheral_interface_gpio_pulse_capture_push(gpio->capture, edge);
+
+	if (g_atomic_int_get(&gpio->cb_info.status) != GPIO_INTERRUPTED_CALLBACK_SET)
+		return true;
+
+	__peripheral_interface_gpio_interrupted_cb_deliver(gpio, PERIPHERAL_ERROR_NONE);
+
+	return (g_hash_table_lookup(dispatcher_handles, GUINT_TO_POINTER(id)) == gpio);
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ */
+static void __peripheral_interface_gpio_cancel_pending(peripheral_gpio_h gpio)
+{
+	if (!gpio->debounce.pending)
+		return;
+
+	gpio->debounce.pending = false;
+	dispatcher_pending--;
+}
+
+static void __peripheral_interface_gpio_dispatch_edges(peripheral_gpio_h gpio)
+{
+	int index;
+	int count;
+	guint id = gpio->watch_id;
+	uint64_t hold_us;
+	gpio_debounce_s *debounce = &gpio->debounce;
+	peripheral_gpio_event_s edges[GPIO_DISPATCHER_EVENTS_MAX];
+
+	hold_us = debounce->min_pulse_us;
+	if (debounce->software && debounce->stable_us > hold_us)
+		hold_us = debounce->stable_us;
+
+	count = __peripheral_interface_gpio_read_edges(gpio, edges, GPIO_DISPATCHER_EVENTS_MAX);
+
+	for (index = 0; index < count; index++) {
+		/*
+		 * An edge is held for the minimum pulse width, or for the stable time without
+		 * the kernel debounce, and is reported only if the pin still has the same value then.
+		 * An edge reverting the held one ends a glitch, so both are dropped.
+		 */
+		if (hold_us > 0) {
+			if (debounce->pending && edges[index].value != debounce->pending_edge.value) {
+				__peripheral_interface_gpio_cancel_pending(gpio);
 				continue;
-		} else {
+			}
+
+			if (!debounce->pending)
+				dispatcher_pending++;
+
+			debounce->pending = true;
+			debounce->pending_edge = edges[index];
+			debounce->deadline = edges[index].timestamp + hold_us * 1000;
 			continue;
 		}
 
-		if (gpio->edge == PERIPHERAL_GPIO_EDGE_NONE)
+		if (!__peripheral_interface_gpio_report_edge(gpio, id, &edges[index]))
+			return;
+	}
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Reports the held edges whose stable time is over and returns the epoll timeout
+ * in milliseconds until the next one.
+ */
+static int __peripheral_interface_gpio_dispatch_pending(void)
+{
+	GHashTableIter iter;
+	gpointer key;
+	gpointer value;
+	GList *expired = NULL;
+	GList *link;
+	peripheral_gpio_h gpio;
+	peripheral_gpio_event_s edge;
+	uint32_t current;
+	uint64_t now;
+	uint64_t next = 0;
+	struct timespec ts;
+
+	if (dispatcher_pending == 0)
+		return -1;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+	g_hash_table_iter_init(&iter, dispatcher_handles);
+	while (g_hash_table_iter_next(&iter, &key, &value)) {
+		gpio = (peripheral_gpio_h)value;
+		if (!gpio->debounce.pending)
+			continue;
+
+		if (gpio->debounce.deadline <= now) {
+			expired = g_list_prepend(expired, key);
 			continue;
+		}
+
+		if (next == 0 || gpio->debounce.deadline < next)
+			next = gpio->debounce.deadline;
+	}
 
-		if (gpio->edge == PERIPHERAL_GPIO_EDGE_RISING && value == 0)
+	/* Handles are looked up again by id, as a callback delivered directly may modify the table */
+	for (link = expired; link != NULL; link = link->next) {
+		gpio = g_hash_table_lookup(dispatcher_handles, link->data);
+		if (gpio == NULL || !gpio->debounce.pending)
 			continue;
 
-		if (gpio->edge == PERIPHERAL_GPIO_EDGE_FALLING && value == 1)
+		edge = gpio->debounce.pending_edge;
+		__peripheral_interface_gpio_cancel_pending(gpio);
+
+		if (peripheral_interface_gpio_read(gpio, &current) != PERIPHERAL_ERROR_NONE || current != edge.value)
 			continue;
 
-		gpio->cb_info.error = PERIPHERAL_ERROR_NONE;
-		g_idle_add_full(G_PRIORITY_HIGH_IDLE, __peripheral_interface_gpio_interrupted_cb_invoke, gpio, NULL);
+		__peripheral_interface_gpio_report_edge(gpio, GPOINTER_TO_UINT(link->data), &edge);
 	}
 
-	return NULL;
+	g_list_free(expired);
+
+	if (next == 0)
+		return (dispatcher_pending == 0) ? -1 : 0;
+
+	return (int)((next - now + 999999) / 1000000);
 }
 
-int peripheral_interface_gpio_set_interrupted_cb(peripheral_gpio_h gpio, peripheral_gpio_interrupted_cb callback, void *user_data)
+static void __peripheral_interface_gpio_dispatcher_wakeup(gpio_dispatcher_s *self)
 {
-	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+	uint64_t one = 1;
 
-	peripheral_interface_gpio_unset_interrupted_cb(gpio);
+	self->stop = TRUE;
+	if (write(self->event_fd, &one, sizeof(one)) != sizeof(one))
+		_E("Failed to wake up the gpio dispatcher");
+}
 
-	gpio->cb_info.cb = callback;
-	gpio->cb_info.user_data = user_data;
-	g_atomic_int_set(&gpio->cb_info.status, GPIO_INTERRUPTED_CALLBACK_SET);
-	gpio->cb_info.thread = g_thread_new(NULL, __peripheral_interface_gpio_poll, gpio);
+/*
+ * Must be called with dispatcher_lock held.
+ * Returns the dispatcher to be joined by the caller once the lock is released.
+ */
+static gpio_dispatcher_s *__peripheral_interface_gpio_dispatcher_detach(void)
+{
+	gpio_dispatcher_s *stopped = dispatcher;
 
-	return PERIPHERAL_ERROR_NONE;
+	if (dispatcher == NULL)
+		return NULL;
+
+	if (!dispatcher->stop && g_hash_table_size(dispatcher_handles) > 0)
+		return NULL;
+
+	__peripheral_interface_gpio_dispatcher_wakeup(dispatcher);
+	dispatcher = NULL;
+
+	return stopped;
 }
 
-int peripheral_interface_gpio_unset_interrupted_cb(peripheral_gpio_h gpio)
+static void __peripheral_interface_gpio_dispatcher_free(gpio_dispatcher_s *stopped)
 {
-	g_atomic_int_set(&gpio->cb_info.status, GPIO_INTERRUPTED_CALLBACK_UNSET);
+	close(stopped->event_fd);
+	close(stopped->epoll_fd);
+	free(stopped);
+}
+
+static void __peripheral_interface_gpio_dispatcher_join(gpio_dispatcher_s *stopped)
+{
+	if (stopped == NULL)
+		return;
 
-	if (gpio->cb_info.thread != NULL) {
-		g_thread_join(gpio->cb_info.thread);
-		gpio->cb_info.thread = NULL;
+	/* Stopped from a callback running on the dispatcher thread, which releases itself on exit */
+	if (stopped->thread == g_thread_self()) {
+		stopped->detached = TRUE;
+		return;
 	}
 
-	return PERIPHERAL_ERROR_NONE;
+	g_thread_join(stopped->thread);
+	__peripheral_interface_gpio_dispatcher_free(stopped);
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Unregisters every handle with an error, as a failing epoll set cannot report edges anymore.
+ */
+static void __peripheral_interface_gpio_dispatcher_abort(gpio_dispatcher_s *self)
+{
+	GHashTableIter iter;
+	gpointer value;
+	GList *aborted = NULL;
+	GList *link;
+	peripheral_gpio_h gpio;
+
+	g_hash_table_iter_init(&iter, dispatcher_handles);
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		gpio = (peripheral_gpio_h)value;
+		gpio->watch_id = 0;
+		__peripheral_interface_gpio_cancel_pending(gpio);
+		g_hash_table_iter_remove(&iter);
+
+		if (g_atomic_int_get(&gpio->cb_info.status) != GPIO_INTERRUPTED_CALLBACK_SET)
+			continue;
+
+		g_atomic_int_set(&gpio->cb_info.status, GPIO_INTERRUPTED_CALLBACK_UNSET);
+		aborted = g_list_prepend(aborted, gpio);
+	}
+
+	__peripheral_interface_gpio_dispatcher_wakeup(self);
+
+	/* The table is not iterated anymore, as a direct callback may modify it */
+	for (link = aborted; link != NULL; link = link->next)
+		__peripheral_interface_gpio_interrupted_cb_deliver((peripheral_gpio_h)link->data, PERIPHERAL_ERROR_IO_ERROR);
+
+	g_list_free(aborted);
+}
+
+static gpointer __peripheral_interface_gpio_dispatch(void *data)
+{
+	gpio_dispatcher_s *self = (gpio_dispatcher_s *)data;
+
+	int index;
+	int count;
+	int timeout = -1;
+	struct epoll_event events[GPIO_DISPATCHER_EVENTS_MAX];
+	peripheral_gpio_h gpio;
+
+	while (TRUE) {
+		count = epoll_wait(self->epoll_fd, events, GPIO_DISPATCHER_EVENTS_MAX, timeout);
+
+		g_rec_mutex_lock(&dispatcher_lock);
+
+		if (self->stop) {
+			g_rec_mutex_unlock(&dispatcher_lock);
+			break;
+		}
+
+		if (count < 0 && errno != EINTR) {
+			_E("epoll_wait failed!");
+			__peripheral_interface_gpio_dispatcher_abort(self);
+			g_rec_mutex_unlock(&dispatcher_lock);
+			break;
+		}
+
+		/* A handle unregistered after epoll_wait() returned is no longer in the table */
+		for (index = 0; index < count; index++) {
+			if (events[index].data.u32 == GPIO_DISPATCHER_WAKEUP_ID)
+				continue;
+
+			gpio = g_hash_table_lookup(dispatcher_handles, GUINT_TO_POINTER(events[index].data.u32));
+			if (gpio != NULL)
+				__peripheral_interface_gpio_dispatch_edges(gpio);
+		}
+
+		timeout = __peripheral_interface_gpio_dispatch_pending();
+
+		g_rec_mutex_unlock(&dispatcher_lock);
+	}
+
+	g_rec_mutex_lock(&dispatcher_lock);
+	if (self->detached) {
+		g_thread_unref(self->thread);
+		__peripheral_interface_gpio_dispatcher_free(self);
+	}
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	return NULL;
+}
+
+static bool __peripheral_interface_gpio_is_watched(peripheral_gpio_h gpio)
+{
+	if (g_atomic_int_get(&gpio->cb_info.status) == GPIO_INTERRUPTED_CALLBACK_SET)
+		return true;
+
+	return (gpio->queue != NULL || gpio->counter != NULL || gpio->capture != NULL);
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Registers the handle to the dispatcher, starting it if needed. A dispatcher that
+ * was stopped before is returned through stopped, to be joined once the lock is released.
+ */
+static int __peripheral_interface_gpio_watch(peripheral_gpio_h gpio, gpio_dispatcher_s **stopped)
+{
+	int ret;
+	struct epoll_event event;
+
+	*stopped = __peripheral_interface_gpio_dispatcher_detach();
+
+	if (gpio->watch_id != 0)
+		return PERIPHERAL_ERROR_NONE;
+
+	if (dispatcher_handles == NULL)
+		dispatcher_handles = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+	if (dispatcher == NULL) {
+		dispatcher = (gpio_dispatcher_s *)calloc(1, sizeof(gpio_dispatcher_s));
+		if (dispatcher == NULL) {
+			_E("Failed to allocate gpio dispatcher");
+			return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+		}
+
+		dispatcher->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		dispatcher->event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.u32 = GPIO_DISPATCHER_WAKEUP_ID;
+
+		if (dispatcher->epoll_fd < 0 || dispatcher->event_fd < 0 ||
+			epoll_ctl(dispatcher->epoll_fd, EPOLL_CTL_ADD, dispatcher->event_fd, &event) < 0) {
+			if (dispatcher->event_fd >= 0)
+				close(dispatcher->event_fd);
+			if (dispatcher->epoll_fd >= 0)
+				close(dispatcher->epoll_fd);
+			free(dispatcher);
+			dispatcher = NULL;
+			_E("Failed to create epoll for gpio dispatcher");
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		dispatcher->thread = g_thread_new("gpio-dispatcher", __peripheral_interface_gpio_dispatch, dispatcher);
+	}
+
+	/* Id 0 is reserved for the wake-up eventfd and for an unregistered handle */
+	if (++dispatcher_next_id == GPIO_DISPATCHER_WAKEUP_ID)
+		++dispatcher_next_id;
+
+	memset(&event, 0, sizeof(event));
+	event.data.u32 = dispatcher_next_id;
+	if (gpio->backend == GPIO_BACKEND_CHARDEV) {
+		event.events = EPOLLIN;
+		ret = epoll_ctl(dispatcher->epoll_fd, EPOLL_CTL_ADD, gpio->fd_line, &event);
+	} else {
+		event.events = EPOLLPRI;
+		ret = epoll_ctl(dispatcher->epoll_fd, EPOLL_CTL_ADD, gpio->fd_value, &event);
+	}
+
+	if (ret < 0) {
+		_E("Failed to add gpio to the dispatcher");
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	gpio->watch_id = dispatcher_next_id;
+	g_hash_table_insert(dispatcher_handles, GUINT_TO_POINTER(gpio->watch_id), gpio);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Must be called with dispatcher_lock held.
+ * Unregisters the handle once nothing is watching it anymore. The dispatcher thread
+ * is stopped together with the last registered handle and returned to be joined.
+ */
+static gpio_dispatcher_s *__peripheral_interface_gpio_unwatch(peripheral_gpio_h gpio)
+{
+	if (gpio->watch_id != 0 && !__peripheral_interface_gpio_is_watched(gpio)) {
+		__peripheral_interface_gpio_cancel_pending(gpio);
+		g_hash_table_remove(dispatcher_handles, GUINT_TO_POINTER(gpio->watch_id));
+		gpio->watch_id = 0;
+
+		if (dispatcher != NULL && !dispatcher->stop) {
+			if (gpio->backend == GPIO_BACKEND_CHARDEV)
+				epoll_ctl(dispatcher->epoll_fd, EPOLL_CTL_DEL, gpio->fd_line, NULL);
+			else
+				epoll_ctl(dispatcher->epoll_fd, EPOLL_CTL_DEL, gpio->fd_value, NULL);
+		}
+	}
+
+	return __peripheral_interface_gpio_dispatcher_detach();
+}
+
+int peripheral_interface_gpio_set_interrupted_cb(peripheral_gpio_h gpio, peripheral_gpio_interrupted_cb callback, void *user_data)
+{
+	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+
+	int ret;
+	gpio_dispatcher_s *stopped;
+	gpio_dispatcher_s *failed;
+
+	peripheral_interface_gpio_unset_interrupted_cb(gpio);
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	ret = __peripheral_interface_gpio_watch(gpio, &stopped);
+	if (ret != PERIPHERAL_ERROR_NONE) {
+		failed = __peripheral_interface_gpio_unwatch(gpio);
+		g_rec_mutex_unlock(&dispatcher_lock);
+		__peripheral_interface_gpio_dispatcher_join(stopped);
+		__peripheral_interface_gpio_dispatcher_join(failed);
+		return ret;
+	}
+
+	gpio->cb_info.cb = callback;
+	gpio->cb_info.user_data = user_data;
+	g_atomic_int_set(&gpio->cb_info.status, GPIO_INTERRUPTED_CALLBACK_SET);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_unset_interrupted_cb(peripheral_gpio_h gpio)
+{
+	gpio_dispatcher_s *stopped;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	g_atomic_int_set(&gpio->cb_info.status, GPIO_INTERRUPTED_CALLBACK_UNSET);
+	stopped = __peripheral_interface_gpio_unwatch(gpio);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_set_event_queue(peripheral_gpio_h gpio, int size)
+{
+	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+
+	int ret;
+	guint capacity = 1;
+	gpio_event_queue_s *queue;
+	gpio_dispatcher_s *stopped;
+	gpio_dispatcher_s *failed;
+
+	/* The queue is indexed with a mask, so its capacity is rounded up to a power of two */
+	while (capacity < (guint)size)
+		capacity <<= 1;
+
+	queue = (gpio_event_queue_s *)calloc(1, sizeof(gpio_event_queue_s));
+	if (queue == NULL) {
+		_E("Failed to allocate gpio event queue");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	queue->events = (peripheral_gpio_event_s *)calloc(capacity, sizeof(peripheral_gpio_event_s));
+	if (queue->events == NULL) {
+		_E("Failed to allocate gpio event queue");
+		free(queue);
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	queue->size = capacity;
+
+	peripheral_interface_gpio_unset_event_queue(gpio);
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	gpio->queue = queue;
+
+	ret = __peripheral_interface_gpio_watch(gpio, &stopped);
+	if (ret != PERIPHERAL_ERROR_NONE) {
+		gpio->queue = NULL;
+		failed = __peripheral_interface_gpio_unwatch(gpio);
+		g_rec_mutex_unlock(&dispatcher_lock);
+		__peripheral_interface_gpio_dispatcher_join(stopped);
+		__peripheral_interface_gpio_dispatcher_join(failed);
+		free(queue->events);
+		free(queue);
+		return ret;
+	}
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_unset_event_queue(peripheral_gpio_h gpio)
+{
+	gpio_event_queue_s *queue;
+	gpio_dispatcher_s *stopped;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	queue = gpio->queue;
+	gpio->queue = NULL;
+	stopped = __peripheral_interface_gpio_unwatch(gpio);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	if (queue != NULL) {
+		free(queue->events);
+		free(queue);
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Single consumer side of the event queue.
+ */
+int peripheral_interface_gpio_read_events(peripheral_gpio_h gpio, peripheral_gpio_event_s *events, int max_count, int *count)
+{
+	gpio_event_queue_s *queue = gpio->queue;
+	guint head;
+	guint tail;
+	guint index;
+	guint length;
+
+	RETV_IF(queue == NULL, PERIPHERAL_ERROR_IO_ERROR);
+
+	tail = (guint)g_atomic_int_get(&queue->tail);
+	head = (guint)g_atomic_int_get(&queue->head);
+
+	length = MIN(head - tail, (guint)max_count);
+	for (index = 0; index < length; index++)
+		events[index] = queue->events[(tail + index) & (queue->size - 1)];
+
+	g_atomic_int_set(&queue->tail, (gint)(tail + length));
+
+	*count = (int)length;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_set_edge_counter(peripheral_gpio_h gpio, uint32_t window_ms)
+{
+	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+
+	int ret;
+	gpio_edge_counter_s *counter;
+	gpio_dispatcher_s *stopped;
+	gpio_dispatcher_s *failed;
+	struct timespec ts;
+
+	counter = (gpio_edge_counter_s *)calloc(1, sizeof(gpio_edge_counter_s));
+	if (counter == NULL) {
+		_E("Failed to allocate gpio edge counter");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	counter->started = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+	counter->slot_start = counter->started;
+	counter->slot_ns = (uint64_t)window_ms * 1000000 / GPIO_COUNTER_SLOTS;
+
+	peripheral_interface_gpio_unset_edge_counter(gpio);
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	gpio->counter = counter;
+
+	ret = __peripheral_interface_gpio_watch(gpio, &stopped);
+	if (ret != PERIPHERAL_ERROR_NONE) {
+		gpio->counter = NULL;
+		failed = __peripheral_interface_gpio_unwatch(gpio);
+		g_rec_mutex_unlock(&dispatcher_lock);
+		__peripheral_interface_gpio_dispatcher_join(stopped);
+		__peripheral_interface_gpio_dispatcher_join(failed);
+		free(counter);
+		return ret;
+	}
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_unset_edge_counter(peripheral_gpio_h gpio)
+{
+	gpio_edge_counter_s *counter;
+	gpio_dispatcher_s *stopped;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	counter = gpio->counter;
+	gpio->counter = NULL;
+	stopped = __peripheral_interface_gpio_unwatch(gpio);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	free(counter);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_get_edge_count(peripheral_gpio_h gpio, uint64_t *count)
+{
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	if (gpio->counter == NULL) {
+		g_rec_mutex_unlock(&dispatcher_lock);
+		_E("gpio edge counter is not set");
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	*count = gpio->counter->total;
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * The frequency is the number of edges in the slots of the window divided by the time
+ * they cover, which is shorter than the window until the counter has run for a full window.
+ */
+int peripheral_interface_gpio_get_edge_frequency(peripheral_gpio_h gpio, double *frequency)
+{
+	int index;
+	uint64_t edges = 0;
+	uint64_t span;
+	uint64_t now;
+	gpio_edge_counter_s *counter;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	counter = gpio->counter;
+	if (counter == NULL) {
+		g_rec_mutex_unlock(&dispatcher_lock);
+		_E("gpio edge counter is not set");
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	__peripheral_interface_gpio_counter_advance(counter, now);
+
+	for (index = 0; index < GPIO_COUNTER_SLOTS; index++)
+		edges += counter->slots[index];
+
+	span = MIN(now - counter->started, (GPIO_COUNTER_SLOTS - 1) * counter->slot_ns + (now - counter->slot_start));
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	*frequency = (span == 0) ? 0.0 : (double)edges * 1000000000.0 / (double)span;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_set_pulse_capture(peripheral_gpio_h gpio, int size)
+{
+	RETV_IF(gpio->direction != PERIPHERAL_GPIO_DIRECTION_IN, PERIPHERAL_ERROR_IO_ERROR);
+	RETV_IF(gpio->edge != PERIPHERAL_GPIO_EDGE_BOTH, PERIPHERAL_ERROR_IO_ERROR);
+
+	int ret;
+	guint capacity = 1;
+	gpio_pulse_capture_s *capture;
+	gpio_dispatcher_s *stopped;
+	gpio_dispatcher_s *failed;
+
+	/* Same as the event queue, the capacity is rounded up to a power of two */
+	while (capacity < (guint)size)
+		capacity <<= 1;
+
+	capture = (gpio_pulse_capture_s *)calloc(1, sizeof(gpio_pulse_capture_s));
+	if (capture == NULL) {
+		_E("Failed to allocate gpio pulse capture");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	capture->pulses = (peripheral_gpio_pulse_s *)calloc(capacity, sizeof(peripheral_gpio_pulse_s));
+	if (capture->pulses == NULL) {
+		_E("Failed to allocate gpio pulse capture");
+		free(capture);
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	capture->size = capacity;
+	capture->state = GPIO_PULSE_CAPTURE_IDLE;
+
+	peripheral_interface_gpio_unset_pulse_capture(gpio);
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	gpio->capture = capture;
+
+	ret = __peripheral_interface_gpio_watch(gpio, &stopped);
+	if (ret != PERIPHERAL_ERROR_NONE) {
+		gpio->capture = NULL;
+		failed = __peripheral_interface_gpio_unwatch(gpio);
+		g_rec_mutex_unlock(&dispatcher_lock);
+		__peripheral_interface_gpio_dispatcher_join(stopped);
+		__peripheral_interface_gpio_dispatcher_join(failed);
+		free(capture->pulses);
+		free(capture);
+		return ret;
+	}
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_unset_pulse_capture(peripheral_gpio_h gpio)
+{
+	gpio_pulse_capture_s *capture;
+	gpio_dispatcher_s *stopped;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	capture = gpio->capture;
+	gpio->capture = NULL;
+	stopped = __peripheral_interface_gpio_unwatch(gpio);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_dispatcher_join(stopped);
+
+	if (capture != NULL) {
+		free(capture->pulses);
+		free(capture);
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Single consumer side of the pulse capture.
+ */
+int peripheral_interface_gpio_read_pulses(peripheral_gpio_h gpio, peripheral_gpio_pulse_s *pulses, int max_count, int *count)
+{
+	gpio_pulse_capture_s *capture = gpio->capture;
+	guint head;
+	guint tail;
+	guint index;
+	guint length;
+
+	RETV_IF(capture == NULL, PERIPHERAL_ERROR_IO_ERROR);
+
+	tail = (guint)g_atomic_int_get(&capture->tail);
+	head = (guint)g_atomic_int_get(&capture->head);
+
+	length = MIN(head - tail, (guint)max_count);
+	for (index = 0; index < length; index++)
+		pulses[index] = capture->pulses[(tail + index) & (capture->size - 1)];
+
+	g_atomic_int_set(&capture->tail, (gint)(tail + length));
+
+	*count = (int)length;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * All pins of a port must belong to one gpiochip so that they can share a single
+ * line request, which is what makes the batched value ioctls possible.
+ */
+int peripheral_interface_gpio_port_open_chardev(peripheral_gpio_port_h port, int *pins, int count)
+{
+	int ret;
+	int index;
+	int fd_chip;
+	uint64_t output = 0;
+	char chip_path[PATH_MAX] = {0, };
+	char path[PATH_MAX];
+	struct gpio_v2_line_info info;
+	struct gpio_v2_line_request request;
+
+	memset(&request, 0, sizeof(request));
+
+	for (index = 0; index < count; index++) {
+		ret = __gpio_chardev_find_line(pins[index], (index == 0) ? chip_path : path, sizeof(path), &request.offsets[index]);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		if (index > 0 && strcmp(chip_path, path)) {
+			_D("gpio pins of the port are on different chips");
+			return PERIPHERAL_ERROR_NOT_SUPPORTED;
+		}
+	}
+
+	fd_chip = open(chip_path, O_RDWR | O_CLOEXEC);
+	CHECK_ERROR(fd_chip < 0);
+
+	ret = 0;
+	for (index = 0; index < count && ret == 0; index++) {
+		memset(&info, 0, sizeof(info));
+		info.offset = request.offsets[index];
+
+		ret = ioctl(fd_chip, GPIO_V2_GET_LINEINFO_IOCTL, &info);
+		if (info.flags & GPIO_V2_LINE_FLAG_OUTPUT)
+			output |= (1ULL << index);
+	}
+
+	if (ret == 0) {
+		request.num_lines = count;
+		strncpy(request.consumer, GPIO_CHARDEV_CONSUMER, sizeof(request.consumer) - 1);
+
+		ret = ioctl(fd_chip, GPIO_V2_GET_LINE_IOCTL, &request);
+	}
+
+	close(fd_chip);
+	CHECK_ERROR(ret < 0);
+
+	port->fd_line = request.fd;
+	port->output = output;
+	port->backend = GPIO_BACKEND_CHARDEV;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static bool __peripheral_interface_gpio_port_waveform_playing(peripheral_gpio_port_h port)
+{
+	return port->waveform != NULL && !g_atomic_int_get(&port->waveform->done);
+}
+
+void peripheral_interface_gpio_port_close(peripheral_gpio_port_h port)
+{
+	if (port->backend == GPIO_BACKEND_CHARDEV)
+		close(port->fd_line);
+}
+
+int peripheral_interface_gpio_port_set_direction(peripheral_gpio_port_h port, uint64_t mask, peripheral_gpio_direction_e direction)
+{
+	int ret;
+	int index;
+	uint64_t output;
+	struct gpio_v2_line_config config;
+	struct gpio_v2_line_values values;
+
+	RETVM_IF(__peripheral_interface_gpio_port_waveform_playing(port), PERIPHERAL_ERROR_RESOURCE_BUSY, "gpio waveform is playing");
+
+	if (port->backend != GPIO_BACKEND_CHARDEV) {
+		for (index = 0; index < port->count; index++) {
+			if (!(mask & (1ULL << index)))
+				continue;
+
+			ret = peripheral_interface_gpio_set_direction(port->gpio[index], direction);
+			if (ret != PERIPHERAL_ERROR_NONE)
+				return ret;
+		}
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	/* Lines that stay output keep their current value across the reconfiguration */
+	memset(&values, 0, sizeof(values));
+	if (port->output) {
+		values.mask = port->output;
+		ret = ioctl(port->fd_line, GPIO_V2_LINE_GET_VALUES_IOCTL, &values);
+		CHECK_ERROR(ret < 0);
+	}
+
+	if (direction == PERIPHERAL_GPIO_DIRECTION_IN) {
+		output = port->output & ~mask;
+	} else {
+		output = port->output | mask;
+		if (direction == PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_HIGH)
+			values.bits |= mask;
+		else
+			values.bits &= ~mask;
+	}
+
+	memset(&config, 0, sizeof(config));
+	config.flags = GPIO_V2_LINE_FLAG_INPUT;
+
+	if (output) {
+		config.num_attrs = 2;
+		config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_FLAGS;
+		config.attrs[0].attr.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+		config.attrs[0].mask = output;
+		config.attrs[1].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+		config.attrs[1].attr.values = values.bits & output;
+		config.attrs[1].mask = output;
+	}
+
+	ret = ioctl(port->fd_line, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config);
+	CHECK_ERROR(ret < 0);
+
+	port->output = output;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_port_read_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t *bits)
+{
+	int ret;
+	int index;
+	uint32_t value;
+	struct gpio_v2_line_values values;
+
+	if (port->backend == GPIO_BACKEND_CHARDEV) {
+		values.bits = 0;
+		values.mask = mask;
+
+		ret = ioctl(port->fd_line, GPIO_V2_LINE_GET_VALUES_IOCTL, &values);
+		CHECK_ERROR(ret < 0);
+
+		*bits = values.bits & mask;
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	*bits = 0;
+	for (index = 0; index < port->count; index++) {
+		if (!(mask & (1ULL << index)))
+			continue;
+
+		ret = peripheral_interface_gpio_read(port->gpio[index], &value);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		if (value)
+			*bits |= (1ULL << index);
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * [direction]     [value]
+ *
+ *    in ---------> write (X)
+ *    out --------> write (O)
+ */
+static int __peripheral_interface_gpio_port_write_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t bits)
+{
+	int ret;
+	int index;
+	struct gpio_v2_line_values values;
+
+	if (port->backend == GPIO_BACKEND_CHARDEV) {
+		RETV_IF(mask & ~port->output, PERIPHERAL_ERROR_IO_ERROR);
+
+		values.bits = bits & mask;
+		values.mask = mask;
+
+		ret = ioctl(port->fd_line, GPIO_V2_LINE_SET_VALUES_IOCTL, &values);
+		CHECK_ERROR(ret < 0);
+
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	for (index = 0; index < port->count; index++) {
+		if (!(mask & (1ULL << index)))
+			continue;
+
+		ret = peripheral_interface_gpio_write(port->gpio[index], (bits >> index) & 1);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_port_write_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t bits)
+{
+	RETVM_IF(__peripheral_interface_gpio_port_waveform_playing(port), PERIPHERAL_ERROR_RESOURCE_BUSY, "gpio waveform is playing");
+
+	return __peripheral_interface_gpio_port_write_mask(port, mask, bits);
+}
+
+static void __peripheral_interface_gpio_waveform_free(gpio_waveform_s *waveform)
+{
+	if (waveform->event_fd >= 0)
+		close(waveform->event_fd);
+
+	free(waveform->steps);
+	free(waveform);
+}
+
+/*
+ * Sleeps until the absolute deadline, or until the waveform is stopped.
+ * The wait is done in poll() on the eventfd of the waveform while more than
+ * a millisecond remains, the rest in clock_nanosleep() to keep the deadline exact.
+ * Returns false when it is stopped.
+ */
+static bool __peripheral_interface_gpio_waveform_sleep(gpio_waveform_s *waveform, const struct timespec *deadline)
+{
+	int64_t remaining;
+	struct timespec now;
+	struct pollfd pfd = { .fd = waveform->event_fd, .events = POLLIN };
+
+	while (!g_atomic_int_get(&waveform->stop)) {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		remaining = (int64_t)(deadline->tv_sec - now.tv_sec) * 1000000000LL + (deadline->tv_nsec - now.tv_nsec);
+		if (remaining < 2000000LL) {
+			while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL) == EINTR);
+			return true;
+		}
+
+		poll(&pfd, 1, (int)(remaining / 1000000LL) - 1);
+	}
+
+	return false;
+}
+
+static gpointer __peripheral_interface_gpio_waveform_play(gpointer data)
+{
+	int ret;
+	int index;
+	int round;
+	peripheral_gpio_port_h port = (peripheral_gpio_port_h)data;
+	gpio_waveform_s *waveform = port->waveform;
+	peripheral_gpio_waveform_step_s *step;
+	struct sched_param param = { .sched_priority = GPIO_WAVEFORM_PRIORITY };
+	struct timespec deadline;
+
+	if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0)
+		_D("Failed to set real-time priority of the gpio waveform thread");
+
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+	for (round = 0; waveform->repeat == 0 || round < waveform->repeat; round++) {
+		for (index = 0; index < waveform->count; index++) {
+			if (g_atomic_int_get(&waveform->stop))
+				goto out;
+
+			step = &waveform->steps[index];
+
+			ret = __peripheral_interface_gpio_port_write_mask(port, step->mask, step->bits);
+			if (ret != PERIPHERAL_ERROR_NONE) {
+				waveform->error = ret;
+				goto out;
+			}
+
+			deadline.tv_nsec += step->delay_ns % 1000000000;
+			deadline.tv_sec += step->delay_ns / 1000000000 + deadline.tv_nsec / 1000000000;
+			deadline.tv_nsec %= 1000000000;
+
+			if (!__peripheral_interface_gpio_waveform_sleep(waveform, &deadline))
+				goto out;
+		}
+	}
+
+out:
+	g_atomic_int_set(&waveform->done, 1);
+
+	return NULL;
+}
+
+int peripheral_interface_gpio_port_start_waveform(peripheral_gpio_port_h port, const peripheral_gpio_waveform_step_s *steps, int count, int repeat)
+{
+	gpio_waveform_s *waveform = port->waveform;
+
+	if (waveform != NULL) {
+		RETVM_IF(!g_atomic_int_get(&waveform->done), PERIPHERAL_ERROR_RESOURCE_BUSY, "gpio waveform is playing");
+		peripheral_interface_gpio_port_stop_waveform(port);
+	}
+
+	waveform = (gpio_waveform_s *)calloc(1, sizeof(gpio_waveform_s));
+	if (waveform == NULL) {
+		_E("Failed to allocate gpio waveform");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	waveform->steps = (peripheral_gpio_waveform_step_s *)malloc(count * sizeof(peripheral_gpio_waveform_step_s));
+	if (waveform->steps == NULL) {
+		_E("Failed to allocate gpio waveform");
+		free(waveform);
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	/* The sleeps between the steps are cut short by peripheral_interface_gpio_port_stop_waveform() */
+	waveform->event_fd = eventfd(0, EFD_CLOEXEC);
+	if (waveform->event_fd < 0) {
+		_E("Failed to create gpio waveform eventfd, errno : %d", errno);
+		__peripheral_interface_gpio_waveform_free(waveform);
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	memcpy(waveform->steps, steps, count * sizeof(peripheral_gpio_waveform_step_s));
+	waveform->count = count;
+	waveform->repeat = repeat;
+
+	port->waveform = waveform;
+
+	waveform->thread = g_thread_try_new("gpio-waveform", __peripheral_interface_gpio_waveform_play, port, NULL);
+	if (waveform->thread == NULL) {
+		_E("Failed to create gpio waveform thread");
+		port->waveform = NULL;
+		__peripheral_interface_gpio_waveform_free(waveform);
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_port_wait_waveform(peripheral_gpio_port_h port)
+{
+	int ret;
+	gpio_waveform_s *waveform = port->waveform;
+
+	RETV_IF(waveform == NULL, PERIPHERAL_ERROR_NONE);
+	RETVM_IF(waveform->repeat == 0, PERIPHERAL_ERROR_IO_ERROR, "gpio waveform is repeated until it is stopped");
+
+	g_thread_join(waveform->thread);
+
+	ret = waveform->error;
+
+	port->waveform = NULL;
+	__peripheral_interface_gpio_waveform_free(waveform);
+
+	return ret;
+}
+
+int peripheral_interface_gpio_port_stop_waveform(peripheral_gpio_port_h port)
+{
+	uint64_t one = 1;
+	gpio_waveform_s *waveform = port->waveform;
+
+	RETV_IF(waveform == NULL, PERIPHERAL_ERROR_NONE);
+
+	g_atomic_int_set(&waveform->stop, 1);
+	if (write(waveform->event_fd, &one, sizeof(one)) != sizeof(one))
+		_E("Failed to wake up the gpio waveform, errno : %d", errno);
+
+	g_thread_join(waveform->thread);
+
+	port->waveform = NULL;
+	__peripheral_interface_gpio_waveform_free(waveform);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_set_interrupted_cb_delivery(peripheral_gpio_h gpio, peripheral_gpio_callback_delivery_e delivery, void *main_context)
+{
+	GMainContext *context = NULL;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	context = gpio->cb_info.context;
+
+	gpio->cb_info.delivery = delivery;
+	gpio->cb_info.context = (main_context != NULL) ? g_main_context_ref((GMainContext *)main_context) : NULL;
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	if (context != NULL)
+		g_main_context_unref(context);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_gpio_set_debounce(peripheral_gpio_h gpio, uint32_t stable_time_us, uint32_t min_pulse_width_us)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	g_rec_mutex_lock(&dispatcher_lock);
+
+	__peripheral_interface_gpio_cancel_pending(gpio);
+
+	gpio->debounce.stable_us = stable_time_us;
+	gpio->debounce.min_pulse_us = min_pulse_width_us;
+	gpio->debounce.software = (gpio->backend != GPIO_BACKEND_CHARDEV);
+
+	/* The stable time is left to the kernel debounce when the line accepts it */
+	if (gpio->backend == GPIO_BACKEND_CHARDEV && gpio->direction == PERIPHERAL_GPIO_DIRECTION_IN)
+		ret = __gpio_chardev_set_config(gpio, gpio->direction, gpio->edge);
+
+	g_rec_mutex_unlock(&dispatcher_lock);
+
+	return ret;
 }
@@ -15,74 +15,223 @@
  */
 
 #include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
 
 #include "peripheral_interface_i2c.h"
 
+#define I2C_POLLER_PRIORITY 50
+#define I2C_POLLER_STOP_CHECK_NS 100000000ULL
+
+static void __peripheral_interface_i2c_bus_acquire(peripheral_i2c_h i2c);
+static void __peripheral_interface_i2c_bus_release(peripheral_i2c_h i2c);
+static void __peripheral_interface_i2c_bus_acquire_atomic(peripheral_i2c_h i2c);
+static void __peripheral_interface_i2c_bus_release_atomic(peripheral_i2c_h i2c);
+
 void peripheral_interface_i2c_close(peripheral_i2c_h i2c)
 {
+	peripheral_interface_i2c_detach_bus(i2c);
+
+	if (i2c->event_fd >= 0)
+		close(i2c->event_fd);
+
 	close(i2c->fd);
+	free(i2c->cache);
 }
 
-/* It was developed temporarily because of the I2C Stub. */
-static int peripheral_interface_i2c_read_buffer(peripheral_i2c_h i2c, uint8_t *data_out, uint32_t length)
+#define I2C_CACHE_BIT_TEST(map, reg)  ((map)[(reg) / 32] & (1U << ((reg) % 32)))
+#define I2C_CACHE_BIT_SET(map, reg)   ((map)[(reg) / 32] |= (1U << ((reg) % 32)))
+#define I2C_CACHE_BIT_CLEAR(map, reg) ((map)[(reg) / 32] &= ~(1U << ((reg) % 32)))
+
+static bool __peripheral_interface_i2c_cache_hit(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out)
 {
-	int ret;
+	i2c_register_cache_s *cache = i2c->cache;
 
-	struct i2c_smbus_ioctl_data data_arg;
-	union i2c_smbus_data data;
+	if (cache == NULL || !I2C_CACHE_BIT_TEST(cache->cacheable, reg) || !I2C_CACHE_BIT_TEST(cache->valid, reg))
+		return false;
 
-	memset(&data, 0x0, sizeof(data.block));
+	*data_out = cache->values[reg];
 
-	data_arg.read_write = I2C_SMBUS_READ;
-	data_arg.size = I2C_SMBUS_BYTE;
-	data_arg.data = &data;
-	data_arg.command = *data_out;
+	return true;
+}
 
-	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
-	CHECK_ERROR(ret != 0);
+static void __peripheral_interface_i2c_cache_store(peripheral_i2c_h i2c, uint8_t reg, uint8_t value)
+{
+	i2c_register_cache_s *cache = i2c->cache;
 
-	*data_out = data.byte;
+	if (cache == NULL || !I2C_CACHE_BIT_TEST(cache->cacheable, reg))
+		return;
+
+	cache->values[reg] = value;
+	I2C_CACHE_BIT_SET(cache->valid, reg);
+}
+
+/*
+ * Values held back in write-back mode are written before any transfer that does not
+ * go through the register byte accessors and may touch them, so that reads see them
+ * and raw writes land after them, as they would have without the cache.
+ */
+static int __peripheral_interface_i2c_cache_flush(peripheral_i2c_h i2c, uint32_t reg, uint32_t length)
+{
+	uint32_t index;
+	i2c_register_cache_s *cache = i2c->cache;
+
+	RETV_IF(cache == NULL, PERIPHERAL_ERROR_NONE);
+
+	for (index = reg; index < reg + length && index < I2C_REGISTER_CACHE_SIZE; index++) {
+		if (I2C_CACHE_BIT_TEST(cache->dirty, index))
+			return peripheral_interface_i2c_sync_registers(i2c);
+	}
 
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int peripheral_interface_i2c_read(peripheral_i2c_h i2c, uint8_t *data_out, uint32_t length)
+/*
+ * Writes that do not go through the register byte accessors leave the device
+ * out of sync with the cache, so the registers they may have touched are read again next time.
+ */
+static int __peripheral_interface_i2c_cache_invalidate(peripheral_i2c_h i2c, uint32_t reg, uint32_t length)
 {
-	int ret = read(i2c->fd, data_out, length);
-	if (ret != length)
-		return peripheral_interface_i2c_read_buffer(i2c, data_out, length);
+	int ret;
+	uint32_t index;
+	i2c_register_cache_s *cache = i2c->cache;
+
+	RETV_IF(cache == NULL, PERIPHERAL_ERROR_NONE);
+
+	ret = __peripheral_interface_i2c_cache_flush(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	for (index = reg; index < reg + length && index < I2C_REGISTER_CACHE_SIZE; index++)
+		I2C_CACHE_BIT_CLEAR(cache->valid, index);
 
 	return PERIPHERAL_ERROR_NONE;
 }
 
-/* It was developed temporarily because of the I2C Stub. */
-static int peripheral_interface_i2c_write_buffer(peripheral_i2c_h i2c, uint8_t *data_in, uint32_t length)
+/*
+ * The transfer path is chosen once from the functionality of the adapter,
+ * so that read and write do not have to try a raw transfer and fall back on every call.
+ */
+int peripheral_interface_i2c_probe(peripheral_i2c_h i2c)
 {
 	int ret;
+	unsigned long funcs = 0;
 
-	struct i2c_smbus_ioctl_data data_arg;
-	union i2c_smbus_data data;
+	ret = ioctl(i2c->fd, I2C_FUNCS, &funcs);
+	if (ret != 0) {
+		_E("Failed to get i2c adapter functionality, assuming plain i2c");
+		funcs = I2C_FUNC_I2C;
+	}
 
-	memset(&data, 0x0, sizeof(data.block));
+	i2c->funcs = funcs;
 
-	data_arg.read_write = I2C_SMBUS_WRITE;
-	data_arg.size = I2C_SMBUS_BYTE;
-	data_arg.data = &data;
-	data_arg.command = *data_in;
+	if (funcs & I2C_FUNC_I2C)
+		i2c->path = PERIPHERAL_I2C_TRANSFER_PATH_I2C;
+	else if ((funcs & I2C_FUNC_SMBUS_I2C_BLOCK) == I2C_FUNC_SMBUS_I2C_BLOCK)
+		i2c->path = PERIPHERAL_I2C_TRANSFER_PATH_SMBUS_I2C_BLOCK;
+	else
+		i2c->path = PERIPHERAL_I2C_TRANSFER_PATH_SMBUS_BYTE;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static int __peripheral_interface_i2c_smbus_access(peripheral_i2c_h i2c, uint8_t read_write, uint8_t command, uint32_t size, union i2c_smbus_data *data)
+{
+	int ret;
+	struct i2c_smbus_ioctl_data data_arg;
+
+	data_arg.read_write = read_write;
+	data_arg.size = size;
+	data_arg.data = data;
+	data_arg.command = command;
 
+	__peripheral_interface_i2c_bus_acquire(i2c);
 	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
 	CHECK_ERROR(ret != 0);
 
 	return PERIPHERAL_ERROR_NONE;
 }
 
+int peripheral_interface_i2c_read(peripheral_i2c_h i2c, uint8_t *data_out, uint32_t length)
+{
+	int ret;
+	uint32_t index;
+	union i2c_smbus_data data;
+
+	ret = __peripheral_interface_i2c_cache_flush(i2c, 0, I2C_REGISTER_CACHE_SIZE);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	if (i2c->path == PERIPHERAL_I2C_TRANSFER_PATH_I2C) {
+		__peripheral_interface_i2c_bus_acquire(i2c);
+		ret = read(i2c->fd, data_out, length);
+		__peripheral_interface_i2c_bus_release(i2c);
+		CHECK_ERROR(ret != length);
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	/* Without plain i2c, the bytes are received one by one */
+	RETVM_IF(!(i2c->funcs & I2C_FUNC_SMBUS_READ_BYTE), PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot receive bytes");
+
+	ret = PERIPHERAL_ERROR_NONE;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+
+	for (index = 0; index < length; index++) {
+		ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_READ, 0, I2C_SMBUS_BYTE, &data);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			break;
+
+		data_out[index] = data.byte;
+	}
+
+	__peripheral_interface_i2c_bus_release(i2c);
+
+	return ret;
+}
+
+/*
+ * Without plain i2c, the first byte is sent as the SMBus command,
+ * which puts the same bytes on the bus as long as they fit in one SMBus transfer.
+ */
 int peripheral_interface_i2c_write(peripheral_i2c_h i2c, uint8_t *data_in, uint32_t length)
 {
-	int ret = write(i2c->fd, data_in, length);
-	if (ret != length)
-		return peripheral_interface_i2c_write_buffer(i2c, data_in, length);
+	int ret;
+	union i2c_smbus_data data;
 
-	return PERIPHERAL_ERROR_NONE;
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, 0, I2C_REGISTER_CACHE_SIZE);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	if (i2c->path == PERIPHERAL_I2C_TRANSFER_PATH_I2C) {
+		__peripheral_interface_i2c_bus_acquire(i2c);
+		ret = write(i2c->fd, data_in, length);
+		__peripheral_interface_i2c_bus_release(i2c);
+		CHECK_ERROR(ret != length);
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	memset(&data, 0x0, sizeof(data.block));
+
+	if (length == 1 && (i2c->funcs & I2C_FUNC_SMBUS_WRITE_BYTE))
+		return __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, data_in[0], I2C_SMBUS_BYTE, &data);
+
+	if (length == 2 && (i2c->funcs & I2C_FUNC_SMBUS_WRITE_BYTE_DATA)) {
+		data.byte = data_in[1];
+		return __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, data_in[0], I2C_SMBUS_BYTE_DATA, &data);
+	}
+
+	if (length >= 2 && length <= I2C_SMBUS_BLOCK_MAX + 1 && (i2c->funcs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK)) {
+		data.block[0] = length - 1;
+		memcpy(&data.block[1], data_in + 1, length - 1);
+		return __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, data_in[0], I2C_SMBUS_I2C_BLOCK_DATA, &data);
+	}
+
+	_E("i2c adapter cannot write %u bytes in one transfer", length);
+	return PERIPHERAL_ERROR_NOT_SUPPORTED;
 }
 
 int peripheral_interface_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out)
@@ -92,6 +241,9 @@ int peripheral_interface_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t re
 	struct i2c_smbus_ioctl_data data_arg;
 	union i2c_smbus_data data;
 
+	if (__peripheral_interface_i2c_cache_hit(i2c, reg, data_out))
+		return PERIPHERAL_ERROR_NONE;
+
 	memset(&data, 0x0, sizeof(data.block));
 
 	data_arg.read_write = I2C_SMBUS_READ;
@@ -99,11 +251,15 @@ int peripheral_interface_i2c_read_register_byte(peripheral_i2c_h i2c, uint8_t re
 	data_arg.data = &data;
 	data_arg.command = reg;
 
+	__peripheral_interface_i2c_bus_acquire(i2c);
 	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
 	CHECK_ERROR(ret != 0);
 
 	*data_out = data.byte;
 
+	__peripheral_interface_i2c_cache_store(i2c, reg, data.byte);
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
@@ -114,6 +270,14 @@ int peripheral_interface_i2c_write_register_byte(peripheral_i2c_h i2c, uint8_t r
 	struct i2c_smbus_ioctl_data data_arg;
 	union i2c_smbus_data data;
 
+	/* In write-back mode, cacheable registers are only written to the device by sync */
+	if (i2c->cache != NULL && i2c->cache->mode == PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK &&
+			I2C_CACHE_BIT_TEST(i2c->cache->cacheable, reg)) {
+		__peripheral_interface_i2c_cache_store(i2c, reg, data_in);
+		I2C_CACHE_BIT_SET(i2c->cache->dirty, reg);
+		return PERIPHERAL_ERROR_NONE;
+	}
+
 	memset(&data, 0x0, sizeof(data.block));
 
 	data_arg.read_write = I2C_SMBUS_WRITE;
@@ -123,9 +287,13 @@ int peripheral_interface_i2c_write_register_byte(peripheral_i2c_h i2c, uint8_t r
 
 	data.byte = data_in;
 
+	__peripheral_interface_i2c_bus_acquire(i2c);
 	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
 	CHECK_ERROR(ret != 0);
 
+	__peripheral_interface_i2c_cache_store(i2c, reg, data_in);
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
@@ -143,7 +311,13 @@ int peripheral_interface_i2c_read_register_word(peripheral_i2c_h i2c, uint8_t re
 	data_arg.data = &data;
 	data_arg.command = reg;
 
+	ret = __peripheral_interface_i2c_cache_flush(i2c, reg, 2);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
 	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
 	CHECK_ERROR(ret != 0);
 
 	*data_out = data.word;
@@ -167,8 +341,1457 @@ int peripheral_interface_i2c_write_register_word(peripheral_i2c_h i2c, uint8_t r
 
 	data.word = data_in;
 
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, reg, 2);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
 	ret = ioctl(i2c->fd, I2C_SMBUS, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
 	CHECK_ERROR(ret != 0);
 
 	return PERIPHERAL_ERROR_NONE;
-}
\ No newline at end of file
+}
+
+int peripheral_interface_i2c_transfer(peripheral_i2c_h i2c, struct i2c_msg *msgs, int count)
+{
+	int ret;
+	struct i2c_rdwr_ioctl_data data_arg;
+
+	data_arg.msgs = msgs;
+	data_arg.nmsgs = count;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+	ret = ioctl(i2c->fd, I2C_RDWR, &data_arg);
+	__peripheral_interface_i2c_bus_release(i2c);
+	CHECK_ERROR(ret != count);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * SMBus-only adapters move a register range with I2C block transfers of up to 32 bytes,
+ * the register address being advanced by the device between the chunks.
+ */
+int peripheral_interface_i2c_read_i2c_block(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length)
+{
+	int ret;
+	uint32_t offset;
+	uint32_t chunk;
+	union i2c_smbus_data data;
+
+	RETVM_IF(!(i2c->funcs & I2C_FUNC_SMBUS_READ_I2C_BLOCK), PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot read i2c blocks");
+	RETVM_IF(reg + length > 256, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c block transfers cannot go past register 0xff");
+
+	ret = __peripheral_interface_i2c_cache_flush(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+
+	for (offset = 0; offset < length; offset += chunk) {
+		chunk = MIN(length - offset, I2C_SMBUS_BLOCK_MAX);
+
+		data.block[0] = chunk;
+		ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_READ, reg + offset, I2C_SMBUS_I2C_BLOCK_DATA, &data);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			break;
+
+		memcpy(data_out + offset, &data.block[1], chunk);
+	}
+
+	__peripheral_interface_i2c_bus_release(i2c);
+
+	return ret;
+}
+
+int peripheral_interface_i2c_write_i2c_block(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length)
+{
+	int ret;
+	uint32_t offset;
+	uint32_t chunk;
+	union i2c_smbus_data data;
+
+	RETVM_IF(!(i2c->funcs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK), PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot write i2c blocks");
+	RETVM_IF(reg + length > 256, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c block transfers cannot go past register 0xff");
+
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+
+	for (offset = 0; offset < length; offset += chunk) {
+		chunk = MIN(length - offset, I2C_SMBUS_BLOCK_MAX);
+
+		data.block[0] = chunk;
+		memcpy(&data.block[1], data_in + offset, chunk);
+
+		ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, reg + offset, I2C_SMBUS_I2C_BLOCK_DATA, &data);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			break;
+	}
+
+	__peripheral_interface_i2c_bus_release(i2c);
+
+	return ret;
+}
+
+/*
+ * The register address is written and the data read back with a repeated start,
+ * so that a multi-byte sample is read in one kernel round trip and cannot be split.
+ */
+int peripheral_interface_i2c_read_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length)
+{
+	int ret;
+
+	if (i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C)
+		return peripheral_interface_i2c_read_i2c_block(i2c, reg, data_out, length);
+
+	ret = __peripheral_interface_i2c_cache_flush(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	struct i2c_msg msgs[2] = {
+		{ .addr = i2c->address, .flags = 0, .len = 1, .buf = &reg },
+		{ .addr = i2c->address, .flags = I2C_M_RD, .len = length, .buf = data_out },
+	};
+
+	return peripheral_interface_i2c_transfer(i2c, msgs, 2);
+}
+
+int peripheral_interface_i2c_write_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length)
+{
+	int ret;
+	uint8_t stack_buf[I2C_BUFFER_MAX + 1];
+	uint8_t *buf = stack_buf;
+	struct i2c_msg msg;
+
+	if (i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C)
+		return peripheral_interface_i2c_write_i2c_block(i2c, reg, data_in, length);
+
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	if (length > I2C_BUFFER_MAX) {
+		buf = (uint8_t *)malloc(length + 1);
+		if (buf == NULL) {
+			_E("Failed to allocate i2c buffer");
+			return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	buf[0] = reg;
+	memcpy(buf + 1, data_in, length);
+
+	msg.addr = i2c->address;
+	msg.flags = 0;
+	msg.len = length + 1;
+	msg.buf = buf;
+
+	ret = peripheral_interface_i2c_transfer(i2c, &msg, 1);
+
+	if (buf != stack_buf)
+		free(buf);
+
+	return ret;
+}
+
+int peripheral_interface_i2c_transaction_submit(peripheral_i2c_transaction_h transaction)
+{
+	int ret;
+	int index;
+	i2c_transaction_msg_s *msg;
+	struct i2c_msg msgs[I2C_TRANSACTION_MSGS_MAX];
+
+	RETVM_IF(transaction->i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot combine messages");
+
+	ret = __peripheral_interface_i2c_cache_invalidate(transaction->i2c, 0, I2C_REGISTER_CACHE_SIZE);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	for (index = 0; index < transaction->count; index++) {
+		msg = &transaction->msgs[index];
+
+		msgs[index].addr = transaction->i2c->address;
+		msgs[index].flags = msg->read ? I2C_M_RD : 0;
+		msgs[index].len = msg->len;
+		msgs[index].buf = msg->buf;
+
+		if (msg->flags & PERIPHERAL_I2C_MESSAGE_FLAG_NO_START)
+			msgs[index].flags |= I2C_M_NOSTART;
+		if (msg->flags & PERIPHERAL_I2C_MESSAGE_FLAG_IGNORE_NAK)
+			msgs[index].flags |= I2C_M_IGNORE_NAK;
+		if (msg->flags & PERIPHERAL_I2C_MESSAGE_FLAG_STOP)
+			msgs[index].flags |= I2C_M_STOP;
+	}
+
+	return peripheral_interface_i2c_transfer(transaction->i2c, msgs, transaction->count);
+}
+
+/*
+ * SMBus block data carries its own length on the bus, so the device decides
+ * how many bytes it returns, up to 32.
+ */
+int peripheral_interface_i2c_read_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t *length)
+{
+	int ret;
+	union i2c_smbus_data data;
+
+	RETVM_IF(!(i2c->funcs & I2C_FUNC_SMBUS_READ_BLOCK_DATA), PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot read smbus blocks");
+
+	ret = __peripheral_interface_i2c_cache_flush(i2c, reg, *length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	memset(&data, 0x0, sizeof(data.block));
+
+	ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_READ, reg, I2C_SMBUS_BLOCK_DATA, &data);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	RETVM_IF(data.block[0] > *length, PERIPHERAL_ERROR_IO_ERROR, "i2c smbus block of %u bytes does not fit in the buffer", data.block[0]);
+
+	memcpy(data_out, &data.block[1], data.block[0]);
+	*length = data.block[0];
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_write_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length)
+{
+	int ret;
+	union i2c_smbus_data data;
+
+	RETVM_IF(!(i2c->funcs & I2C_FUNC_SMBUS_WRITE_BLOCK_DATA), PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot write smbus blocks");
+
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, reg, length);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	data.block[0] = length;
+	memcpy(&data.block[1], data_in, length);
+
+	return __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, reg, I2C_SMBUS_BLOCK_DATA, &data);
+}
+
+int peripheral_interface_i2c_get_transfer_path(peripheral_i2c_h i2c, peripheral_i2c_transfer_path_e *path)
+{
+	*path = i2c->path;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_set_register_cacheable(peripheral_i2c_h i2c, uint8_t reg, bool cacheable)
+{
+	if (i2c->cache == NULL) {
+		if (!cacheable)
+			return PERIPHERAL_ERROR_NONE;
+
+		i2c->cache = (i2c_register_cache_s *)calloc(1, sizeof(i2c_register_cache_s));
+		if (i2c->cache == NULL) {
+			_E("Failed to allocate i2c register cache");
+			return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	if (cacheable) {
+		I2C_CACHE_BIT_SET(i2c->cache->cacheable, reg);
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	RETVM_IF(I2C_CACHE_BIT_TEST(i2c->cache->dirty, reg), PERIPHERAL_ERROR_RESOURCE_BUSY, "i2c register 0x%x is not synced", reg);
+
+	I2C_CACHE_BIT_CLEAR(i2c->cache->cacheable, reg);
+	I2C_CACHE_BIT_CLEAR(i2c->cache->valid, reg);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_set_register_cache_mode(peripheral_i2c_h i2c, peripheral_i2c_register_cache_mode_e mode)
+{
+	int ret;
+
+	RETVM_IF(i2c->cache == NULL, PERIPHERAL_ERROR_IO_ERROR, "i2c register cache is not set");
+
+	/* Leaving write-back mode flushes what has not been written yet */
+	if (mode == PERIPHERAL_I2C_REGISTER_CACHE_WRITE_THROUGH) {
+		ret = peripheral_interface_i2c_sync_registers(i2c);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	i2c->cache->mode = mode;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_update_register_bits(peripheral_i2c_h i2c, uint8_t reg, uint8_t mask, uint8_t value)
+{
+	int ret;
+	uint8_t current;
+	uint8_t updated;
+
+	/* The bus is held so that no other handle writes the register between the read and the write */
+	__peripheral_interface_i2c_bus_acquire_atomic(i2c);
+
+	ret = peripheral_interface_i2c_read_register_byte(i2c, reg, &current);
+	if (ret == PERIPHERAL_ERROR_NONE) {
+		updated = (current & ~mask) | (value & mask);
+		if (updated != current)
+			ret = peripheral_interface_i2c_write_register_byte(i2c, reg, updated);
+	}
+
+	__peripheral_interface_i2c_bus_release_atomic(i2c);
+
+	return ret;
+}
+
+static void __peripheral_interface_i2c_cache_clear_dirty(i2c_register_cache_s *cache, uint32_t reg, uint32_t end)
+{
+	for (; reg < end; reg++)
+		I2C_CACHE_BIT_CLEAR(cache->dirty, reg);
+}
+
+/*
+ * Without plain i2c, a run of dirty registers is written with I2C block transfers
+ * when the adapter has them, one register at a time otherwise.
+ */
+static int __peripheral_interface_i2c_cache_write_run_smbus(peripheral_i2c_h i2c, uint32_t reg, uint32_t end)
+{
+	int ret;
+	uint32_t chunk;
+	union i2c_smbus_data data;
+	i2c_register_cache_s *cache = i2c->cache;
+
+	for (; reg < end; reg += chunk) {
+		memset(&data, 0x0, sizeof(data.block));
+
+		if (i2c->funcs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK) {
+			chunk = MIN(end - reg, I2C_SMBUS_BLOCK_MAX);
+			data.block[0] = chunk;
+			memcpy(&data.block[1], &cache->values[reg], chunk);
+			ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, reg, I2C_SMBUS_I2C_BLOCK_DATA, &data);
+		} else {
+			chunk = 1;
+			data.byte = cache->values[reg];
+			ret = __peripheral_interface_i2c_smbus_access(i2c, I2C_SMBUS_WRITE, reg, I2C_SMBUS_BYTE_DATA, &data);
+		}
+
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		__peripheral_interface_i2c_cache_clear_dirty(cache, reg, reg + chunk);
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Runs of consecutive dirty registers are written as one message each,
+ * and as many messages as fit go in one I2C_RDWR.
+ */
+static int __peripheral_interface_i2c_sync_registers(peripheral_i2c_h i2c)
+{
+	int ret;
+	int index;
+	int count = 0;
+	uint32_t reg = 0;
+	uint32_t end;
+	uint32_t used = 0;
+	i2c_register_cache_s *cache = i2c->cache;
+	uint8_t buf[I2C_REGISTER_CACHE_SIZE * 2];
+	struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+
+	RETV_IF(cache == NULL, PERIPHERAL_ERROR_NONE);
+
+	while (reg < I2C_REGISTER_CACHE_SIZE || count > 0) {
+		while (reg < I2C_REGISTER_CACHE_SIZE && !I2C_CACHE_BIT_TEST(cache->dirty, reg))
+			reg++;
+
+		if (reg < I2C_REGISTER_CACHE_SIZE) {
+			end = reg;
+			while (end < I2C_REGISTER_CACHE_SIZE && I2C_CACHE_BIT_TEST(cache->dirty, end))
+				end++;
+
+			if (i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C) {
+				ret = __peripheral_interface_i2c_cache_write_run_smbus(i2c, reg, end);
+				if (ret != PERIPHERAL_ERROR_NONE)
+					return ret;
+
+				reg = end;
+				continue;
+			}
+
+			msgs[count].addr = i2c->address;
+			msgs[count].flags = 0;
+			msgs[count].len = end - reg + 1;
+			msgs[count].buf = &buf[used];
+
+			buf[used] = reg;
+			memcpy(&buf[used + 1], &cache->values[reg], end - reg);
+
+			used += end - reg + 1;
+			count++;
+			reg = end;
+
+			if (count < I2C_RDWR_IOCTL_MAX_MSGS && reg < I2C_REGISTER_CACHE_SIZE)
+				continue;
+		}
+
+		if (count == 0)
+			continue;
+
+		ret = peripheral_interface_i2c_transfer(i2c, msgs, count);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		for (index = 0; index < count; index++)
+			__peripheral_interface_i2c_cache_clear_dirty(cache, msgs[index].buf[0], msgs[index].buf[0] + msgs[index].len - 1);
+
+		count = 0;
+		used = 0;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_sync_registers(peripheral_i2c_h i2c)
+{
+	int ret;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+	ret = __peripheral_interface_i2c_sync_registers(i2c);
+	__peripheral_interface_i2c_bus_release(i2c);
+
+	return ret;
+}
+
+int peripheral_interface_i2c_invalidate_register_cache(peripheral_i2c_h i2c)
+{
+	RETV_IF(i2c->cache == NULL, PERIPHERAL_ERROR_NONE);
+
+	memset(i2c->cache->valid, 0, sizeof(i2c->cache->valid));
+	memset(i2c->cache->dirty, 0, sizeof(i2c->cache->dirty));
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Every handle on a bus shares one arbiter. Each kernel transfer is a transaction on the bus
+ * and is granted by the arbiter to the waiter of highest priority, in arrival order among equal
+ * priorities. An operation made of several transfers holds the bus from its first transfer to
+ * its last, unless the hold time of its handle runs out, in which case it queues again at the
+ * next transaction boundary so that the other waiters go first.
+ *
+ * Asynchronous requests are run by one worker thread per bus, started on the first request.
+ * Its queue is sorted by the same priority and arrival order, which keeps the requests of each
+ * handle in order since the priority of a handle cannot change while requests are queued.
+ */
+typedef enum {
+	I2C_REQUEST_STOP = 0,
+	I2C_REQUEST_READ,
+	I2C_REQUEST_WRITE,
+	I2C_REQUEST_READ_REGISTERS,
+	I2C_REQUEST_WRITE_REGISTERS,
+	I2C_REQUEST_TRANSACTION,
+} i2c_request_type_e;
+
+typedef struct {
+	i2c_request_type_e type;
+	peripheral_i2c_h i2c;
+	peripheral_i2c_transaction_h transaction;
+	uint8_t reg;
+	uint8_t *data;
+	uint32_t length;
+	peripheral_i2c_completed_cb callback;
+	void *user_data;
+	int priority;
+	uint64_t seq;
+} i2c_request_s;
+
+typedef struct {
+	int priority;
+	uint64_t seq;
+} i2c_bus_waiter_s;
+
+struct _peripheral_i2c_bus_s {
+	int bus;
+	int refcount;
+	GMutex lock;
+	GCond cond;
+	GThread *owner;
+	int depth;
+	int no_yield;
+	gint64 granted_at;
+	GList *waiters;
+	uint64_t seq;
+	GThread *worker;
+	GAsyncQueue *queue;
+	peripheral_i2c_h running;
+};
+
+static GMutex buses_lock;
+static GHashTable *buses = NULL;
+
+int peripheral_interface_i2c_attach_bus(peripheral_i2c_h i2c)
+{
+	i2c_bus_s *bus;
+
+	g_mutex_lock(&buses_lock);
+
+	if (buses == NULL)
+		buses = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+	bus = g_hash_table_lookup(buses, GINT_TO_POINTER(i2c->bus));
+	if (bus == NULL) {
+		bus = (i2c_bus_s *)calloc(1, sizeof(i2c_bus_s));
+		if (bus == NULL) {
+			g_mutex_unlock(&buses_lock);
+			_E("Failed to allocate i2c bus arbiter");
+			return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+		}
+
+		bus->bus = i2c->bus;
+		g_mutex_init(&bus->lock);
+		g_cond_init(&bus->cond);
+
+		g_hash_table_insert(buses, GINT_TO_POINTER(i2c->bus), bus);
+	}
+
+	bus->refcount++;
+	i2c->arbiter = bus;
+
+	g_mutex_unlock(&buses_lock);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static gint __peripheral_interface_i2c_bus_waiter_compare(gconstpointer a, gconstpointer b)
+{
+	const i2c_bus_waiter_s *waiter_a = (const i2c_bus_waiter_s *)a;
+	const i2c_bus_waiter_s *waiter_b = (const i2c_bus_waiter_s *)b;
+
+	if (waiter_a->priority != waiter_b->priority)
+		return waiter_b->priority - waiter_a->priority;
+
+	return (waiter_a->seq < waiter_b->seq) ? -1 : 1;
+}
+
+/* Called with the bus lock held */
+static void __peripheral_interface_i2c_bus_wait(i2c_bus_s *bus, peripheral_i2c_h i2c)
+{
+	i2c_bus_waiter_s waiter = { .priority = i2c->priority, .seq = bus->seq++ };
+
+	if (bus->owner != NULL || bus->waiters != NULL) {
+		bus->waiters = g_list_insert_sorted(bus->waiters, &waiter, __peripheral_interface_i2c_bus_waiter_compare);
+
+		while (bus->owner != NULL || bus->waiters->data != &waiter)
+			g_cond_wait(&bus->cond, &bus->lock);
+
+		bus->waiters = g_list_delete_link(bus->waiters, bus->waiters);
+	}
+
+	bus->owner = g_thread_self();
+	bus->granted_at = g_get_monotonic_time();
+}
+
+static void __peripheral_interface_i2c_bus_acquire(peripheral_i2c_h i2c)
+{
+	int depth;
+	i2c_bus_s *bus = i2c->arbiter;
+
+	if (bus == NULL)
+		return;
+
+	g_mutex_lock(&bus->lock);
+
+	if (bus->owner != g_thread_self()) {
+		__peripheral_interface_i2c_bus_wait(bus, i2c);
+		bus->depth = 1;
+		g_mutex_unlock(&bus->lock);
+		return;
+	}
+
+	/* The bus is not given away inside a section that must stay atomic */
+	if (i2c->max_hold_time > 0 && bus->no_yield == 0 && bus->waiters != NULL &&
+			g_get_monotonic_time() - bus->granted_at >= i2c->max_hold_time) {
+		depth = bus->depth;
+		bus->owner = NULL;
+		g_cond_broadcast(&bus->cond);
+
+		__peripheral_interface_i2c_bus_wait(bus, i2c);
+		bus->depth = depth;
+	}
+
+	bus->depth++;
+
+	g_mutex_unlock(&bus->lock);
+}
+
+static void __peripheral_interface_i2c_bus_release(peripheral_i2c_h i2c)
+{
+	i2c_bus_s *bus = i2c->arbiter;
+
+	if (bus == NULL)
+		return;
+
+	g_mutex_lock(&bus->lock);
+
+	if (--bus->depth == 0) {
+		bus->owner = NULL;
+		g_cond_broadcast(&bus->cond);
+	}
+
+	g_mutex_unlock(&bus->lock);
+}
+
+/*
+ * Holds the bus like __peripheral_interface_i2c_bus_acquire(), without yielding it
+ * to waiters past the max hold time until the matching release.
+ */
+static void __peripheral_interface_i2c_bus_acquire_atomic(peripheral_i2c_h i2c)
+{
+	i2c_bus_s *bus = i2c->arbiter;
+
+	__peripheral_interface_i2c_bus_acquire(i2c);
+
+	if (bus == NULL)
+		return;
+
+	g_mutex_lock(&bus->lock);
+	bus->no_yield++;
+	g_mutex_unlock(&bus->lock);
+}
+
+static void __peripheral_interface_i2c_bus_release_atomic(peripheral_i2c_h i2c)
+{
+	i2c_bus_s *bus = i2c->arbiter;
+
+	if (bus != NULL) {
+		g_mutex_lock(&bus->lock);
+		bus->no_yield--;
+		g_mutex_unlock(&bus->lock);
+	}
+
+	__peripheral_interface_i2c_bus_release(i2c);
+}
+
+static int __peripheral_interface_i2c_request_run(i2c_request_s *request)
+{
+	switch (request->type) {
+	case I2C_REQUEST_READ:
+		return peripheral_interface_i2c_read(request->i2c, request->data, request->length);
+	case I2C_REQUEST_WRITE:
+		return peripheral_interface_i2c_write(request->i2c, request->data, request->length);
+	case I2C_REQUEST_READ_REGISTERS:
+		return peripheral_interface_i2c_read_registers(request->i2c, request->reg, request->data, request->length);
+	case I2C_REQUEST_WRITE_REGISTERS:
+		return peripheral_interface_i2c_write_registers(request->i2c, request->reg, request->data, request->length);
+	case I2C_REQUEST_TRANSACTION:
+		return peripheral_interface_i2c_transaction_submit(request->transaction);
+	default:
+		return PERIPHERAL_ERROR_UNKNOWN;
+	}
+}
+
+static gint __peripheral_interface_i2c_request_compare(gconstpointer a, gconstpointer b, gpointer user_data)
+{
+	const i2c_request_s *request_a = (const i2c_request_s *)a;
+	const i2c_request_s *request_b = (const i2c_request_s *)b;
+
+	if (request_a->priority != request_b->priority)
+		return request_b->priority - request_a->priority;
+
+	return (request_a->seq < request_b->seq) ? -1 : 1;
+}
+
+static gpointer __peripheral_interface_i2c_worker(gpointer data)
+{
+	int ret;
+	int event_fd;
+	uint64_t one = 1;
+	i2c_bus_s *bus = (i2c_bus_s *)data;
+	i2c_request_s *request;
+	peripheral_i2c_h i2c;
+
+	while (TRUE) {
+		request = (i2c_request_s *)g_async_queue_pop(bus->queue);
+		if (request->type == I2C_REQUEST_STOP) {
+			free(request);
+			break;
+		}
+
+		i2c = request->i2c;
+
+		ret = __peripheral_interface_i2c_request_run(request);
+
+		/*
+		 * The request is no longer pending once it ran, so the callback
+		 * can queue or change the priority again. The handle stays
+		 * marked as running until it is signaled, so that it can not be
+		 * closed under the callback.
+		 */
+		g_mutex_lock(&bus->lock);
+		i2c->pending--;
+		bus->running = i2c;
+		g_mutex_unlock(&bus->lock);
+
+		if (request->callback != NULL)
+			request->callback(i2c, ret, request->user_data);
+
+		event_fd = g_atomic_int_get(&i2c->event_fd);
+		if (event_fd >= 0 && write(event_fd, &one, sizeof(one)) != sizeof(one))
+			_E("Failed to signal i2c completion, errno : %d", errno);
+
+		free(request);
+
+		g_mutex_lock(&bus->lock);
+		bus->running = NULL;
+		g_cond_broadcast(&bus->cond);
+		g_mutex_unlock(&bus->lock);
+	}
+
+	return NULL;
+}
+
+/* Called with the bus lock held */
+static int __peripheral_interface_i2c_start_worker(i2c_bus_s *bus)
+{
+	if (bus->worker != NULL)
+		return PERIPHERAL_ERROR_NONE;
+
+	bus->queue = g_async_queue_new();
+
+	bus->worker = g_thread_try_new("i2c-worker", __peripheral_interface_i2c_worker, bus, NULL);
+	if (bus->worker == NULL) {
+		_E("Failed to create i2c worker thread");
+		g_async_queue_unref(bus->queue);
+		bus->queue = NULL;
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Waits for the queued requests of the handle, and frees the arbiter
+ * of the bus and stops its worker when no other handle uses them.
+ */
+void peripheral_interface_i2c_detach_bus(peripheral_i2c_h i2c)
+{
+	i2c_bus_s *bus = i2c->arbiter;
+	i2c_request_s *stop;
+
+	if (bus == NULL)
+		return;
+
+	g_mutex_lock(&bus->lock);
+	while (i2c->pending > 0 || bus->running == i2c)
+		g_cond_wait(&bus->cond, &bus->lock);
+	g_mutex_unlock(&bus->lock);
+
+	i2c->arbiter = NULL;
+
+	g_mutex_lock(&buses_lock);
+
+	if (--bus->refcount > 0) {
+		g_mutex_unlock(&buses_lock);
+		return;
+	}
+
+	g_hash_table_remove(buses, GINT_TO_POINTER(bus->bus));
+
+	g_mutex_unlock(&buses_lock);
+
+	if (bus->worker != NULL) {
+		stop = (i2c_request_s *)calloc(1, sizeof(i2c_request_s));
+		if (stop == NULL) {
+			/* The worker is left running rather than freed under it */
+			_E("Failed to allocate i2c worker stop request");
+			return;
+		}
+
+		stop->type = I2C_REQUEST_STOP;
+		g_async_queue_push(bus->queue, stop);
+		g_thread_join(bus->worker);
+		g_async_queue_unref(bus->queue);
+	}
+
+	g_mutex_clear(&bus->lock);
+	g_cond_clear(&bus->cond);
+	free(bus);
+}
+
+static int __peripheral_interface_i2c_queue(peripheral_i2c_h i2c, i2c_request_s *template)
+{
+	int ret;
+	i2c_bus_s *bus = i2c->arbiter;
+	i2c_request_s *request;
+
+	RETVM_IF(bus == NULL, PERIPHERAL_ERROR_UNKNOWN, "i2c bus arbiter is not available");
+
+	request = (i2c_request_s *)malloc(sizeof(i2c_request_s));
+	if (request == NULL) {
+		_E("Failed to allocate i2c request");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	*request = *template;
+	request->i2c = i2c;
+	request->priority = i2c->priority;
+
+	g_mutex_lock(&bus->lock);
+
+	ret = __peripheral_interface_i2c_start_worker(bus);
+	if (ret != PERIPHERAL_ERROR_NONE) {
+		g_mutex_unlock(&bus->lock);
+		free(request);
+		return ret;
+	}
+
+	request->seq = bus->seq++;
+	i2c->pending++;
+
+	g_async_queue_push_sorted(bus->queue, request, __peripheral_interface_i2c_request_compare, NULL);
+
+	g_mutex_unlock(&bus->lock);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_read_async(peripheral_i2c_h i2c, uint8_t *data_out, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	i2c_request_s request = {
+		.type = I2C_REQUEST_READ, .data = data_out, .length = length,
+		.callback = callback, .user_data = user_data,
+	};
+
+	return __peripheral_interface_i2c_queue(i2c, &request);
+}
+
+int peripheral_interface_i2c_write_async(peripheral_i2c_h i2c, uint8_t *data_in, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	i2c_request_s request = {
+		.type = I2C_REQUEST_WRITE, .data = data_in, .length = length,
+		.callback = callback, .user_data = user_data,
+	};
+
+	return __peripheral_interface_i2c_queue(i2c, &request);
+}
+
+int peripheral_interface_i2c_read_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_out, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	i2c_request_s request = {
+		.type = I2C_REQUEST_READ_REGISTERS, .reg = reg, .data = data_out, .length = length,
+		.callback = callback, .user_data = user_data,
+	};
+
+	return __peripheral_interface_i2c_queue(i2c, &request);
+}
+
+int peripheral_interface_i2c_write_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data_in, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	i2c_request_s request = {
+		.type = I2C_REQUEST_WRITE_REGISTERS, .reg = reg, .data = data_in, .length = length,
+		.callback = callback, .user_data = user_data,
+	};
+
+	return __peripheral_interface_i2c_queue(i2c, &request);
+}
+
+int peripheral_interface_i2c_transaction_submit_async(peripheral_i2c_transaction_h transaction, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	i2c_request_s request = {
+		.type = I2C_REQUEST_TRANSACTION, .transaction = transaction,
+		.callback = callback, .user_data = user_data,
+	};
+
+	return __peripheral_interface_i2c_queue(transaction->i2c, &request);
+}
+
+int peripheral_interface_i2c_get_completion_fd(peripheral_i2c_h i2c, int *fd)
+{
+	int event_fd;
+	i2c_bus_s *bus = i2c->arbiter;
+
+	RETVM_IF(bus == NULL, PERIPHERAL_ERROR_UNKNOWN, "i2c bus arbiter is not available");
+
+	/* The worker may be signaling requests of the handle meanwhile */
+	g_mutex_lock(&bus->lock);
+
+	event_fd = g_atomic_int_get(&i2c->event_fd);
+	if (event_fd < 0) {
+		event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (event_fd < 0) {
+			g_mutex_unlock(&bus->lock);
+			_E("Failed to create i2c completion fd, errno : %d", errno);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		g_atomic_int_set(&i2c->event_fd, event_fd);
+	}
+
+	g_mutex_unlock(&bus->lock);
+
+	*fd = event_fd;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_set_priority(peripheral_i2c_h i2c, int priority)
+{
+	i2c_bus_s *bus = i2c->arbiter;
+
+	RETVM_IF(bus == NULL, PERIPHERAL_ERROR_UNKNOWN, "i2c bus arbiter is not available");
+
+	g_mutex_lock(&bus->lock);
+
+	if (i2c->pending > 0) {
+		g_mutex_unlock(&bus->lock);
+		_E("i2c handle has queued requests");
+		return PERIPHERAL_ERROR_RESOURCE_BUSY;
+	}
+
+	i2c->priority = priority;
+
+	g_mutex_unlock(&bus->lock);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_set_max_hold_time(peripheral_i2c_h i2c, uint32_t hold_time_us)
+{
+	i2c->max_hold_time = hold_time_us;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static uint64_t __peripheral_interface_i2c_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+int peripheral_interface_i2c_poller_add_job(peripheral_i2c_poller_h poller, peripheral_i2c_h i2c, uint8_t reg, uint32_t length, uint32_t period_us, int size, int *job_id)
+{
+	guint capacity = 1;
+	i2c_poll_job_s *job;
+
+	RETVM_IF(poller->thread != NULL, PERIPHERAL_ERROR_RESOURCE_BUSY, "i2c poller is running");
+	RETVM_IF(poller->count == I2C_POLLER_JOBS_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller cannot hold more jobs");
+
+	/* Same as the gpio event queue, the capacity is rounded up to a power of two */
+	while (capacity < (guint)size)
+		capacity <<= 1;
+
+	job = &poller->jobs[poller->count];
+
+	job->samples = (uint8_t *)calloc(capacity, length);
+	job->timestamps = (uint64_t *)calloc(capacity, sizeof(uint64_t));
+	if (job->samples == NULL || job->timestamps == NULL) {
+		_E("Failed to allocate i2c poll job");
+		free(job->samples);
+		free(job->timestamps);
+		memset(job, 0, sizeof(i2c_poll_job_s));
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	job->i2c = i2c;
+	job->reg = reg;
+	job->length = length;
+	job->period = (uint64_t)period_us * 1000;
+	job->size = capacity;
+	job->head = 0;
+	job->tail = 0;
+
+	*job_id = poller->count++;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Single producer side of a poll job. When the ring is full the job is skipped,
+ * so that no transfer is made for a sample which would be dropped.
+ */
+static uint8_t *__peripheral_interface_i2c_poll_job_slot(i2c_poll_job_s *job)
+{
+	guint head = (guint)g_atomic_int_get(&job->head);
+	guint tail = (guint)g_atomic_int_get(&job->tail);
+
+	if (head - tail >= job->size)
+		return NULL;
+
+	return job->samples + (head & (job->size - 1)) * job->length;
+}
+
+static void __peripheral_interface_i2c_poll_job_commit(i2c_poll_job_s *job, uint64_t timestamp)
+{
+	guint head = (guint)g_atomic_int_get(&job->head);
+
+	job->timestamps[head & (job->size - 1)] = timestamp;
+	g_atomic_int_set(&job->head, (gint)(head + 1));
+}
+
+static void __peripheral_interface_i2c_poll_job_read(i2c_poll_job_s *job)
+{
+	uint64_t timestamp = __peripheral_interface_i2c_now();
+
+	if (peripheral_interface_i2c_read_registers(job->i2c, job->reg, __peripheral_interface_i2c_poll_job_slot(job), job->length) == PERIPHERAL_ERROR_NONE)
+		__peripheral_interface_i2c_poll_job_commit(job, timestamp);
+}
+
+/*
+ * The jobs due at the same tick on one bus are read in a single I2C_RDWR,
+ * a register address write and a data read for each, as long as their handles can do plain i2c.
+ * When the combined transfer fails, the jobs are read one by one so that a single
+ * missing device does not cost the samples of the others.
+ */
+static void __peripheral_interface_i2c_poller_run_tick(peripheral_i2c_poller_h poller, uint64_t now)
+{
+	int index;
+	int next;
+	int count;
+	int batched;
+	uint64_t timestamp;
+	i2c_poll_job_s *job;
+	i2c_poll_job_s *due[I2C_POLLER_JOBS_MAX];
+	i2c_poll_job_s *batch[I2C_RDWR_IOCTL_MAX_MSGS / 2];
+	struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+
+	for (index = 0, count = 0; index < poller->count; index++) {
+		job = &poller->jobs[index];
+		if (job->next > now)
+			continue;
+
+		/* Missed deadlines are skipped, the job keeps its phase */
+		job->next += ((now - job->next) / job->period + 1) * job->period;
+
+		if (__peripheral_interface_i2c_poll_job_slot(job) != NULL)
+			due[count++] = job;
+	}
+
+	for (index = 0; index < count; index++) {
+		if (due[index] == NULL)
+			continue;
+
+		batched = 0;
+		for (next = index; next < count && batched < I2C_RDWR_IOCTL_MAX_MSGS / 2; next++) {
+			job = due[next];
+			if (job == NULL || job->i2c->bus != due[index]->i2c->bus || job->i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C)
+				continue;
+
+			/* A job whose registers cannot be synced is left to the single read, which reports nothing */
+			if (__peripheral_interface_i2c_cache_flush(job->i2c, job->reg, job->length) != PERIPHERAL_ERROR_NONE)
+				continue;
+
+			msgs[batched * 2].addr = job->i2c->address;
+			msgs[batched * 2].flags = 0;
+			msgs[batched * 2].len = 1;
+			msgs[batched * 2].buf = &job->reg;
+			msgs[batched * 2 + 1].addr = job->i2c->address;
+			msgs[batched * 2 + 1].flags = I2C_M_RD;
+			msgs[batched * 2 + 1].len = job->length;
+			msgs[batched * 2 + 1].buf = __peripheral_interface_i2c_poll_job_slot(job);
+
+			batch[batched++] = job;
+			due[next] = NULL;
+		}
+
+		if (batched == 0) {
+			__peripheral_interface_i2c_poll_job_read(due[index]);
+			due[index] = NULL;
+			continue;
+		}
+
+		timestamp = __peripheral_interface_i2c_now();
+
+		if (peripheral_interface_i2c_transfer(batch[0]->i2c, msgs, batched * 2) == PERIPHERAL_ERROR_NONE) {
+			for (next = 0; next < batched; next++)
+				__peripheral_interface_i2c_poll_job_commit(batch[next], timestamp);
+		} else {
+			for (next = 0; next < batched; next++)
+				__peripheral_interface_i2c_poll_job_read(batch[next]);
+		}
+	}
+}
+
+/*
+ * Every job is scheduled at absolute deadlines on CLOCK_MONOTONIC from the start of the poller,
+ * so the jobs with related periods keep sharing their ticks. The sleeps are cut in slices
+ * so that a stop request is noticed even with long periods.
+ */
+static gpointer __peripheral_interface_i2c_poller_run(gpointer data)
+{
+	int index;
+	uint64_t now;
+	uint64_t wake;
+	peripheral_i2c_poller_h poller = (peripheral_i2c_poller_h)data;
+	struct sched_param param = { .sched_priority = I2C_POLLER_PRIORITY };
+	struct timespec deadline;
+
+	if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0)
+		_D("Failed to set real-time priority of the i2c poller thread");
+
+	while (!g_atomic_int_get(&poller->stop)) {
+		now = __peripheral_interface_i2c_now();
+
+		wake = now + I2C_POLLER_STOP_CHECK_NS;
+		for (index = 0; index < poller->count; index++)
+			wake = MIN(wake, poller->jobs[index].next);
+
+		if (wake > now) {
+			deadline.tv_sec = wake / 1000000000;
+			deadline.tv_nsec = wake % 1000000000;
+			while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR);
+			continue;
+		}
+
+		__peripheral_interface_i2c_poller_run_tick(poller, now);
+	}
+
+	return NULL;
+}
+
+int peripheral_interface_i2c_poller_start(peripheral_i2c_poller_h poller)
+{
+	int index;
+	uint64_t now = __peripheral_interface_i2c_now();
+
+	RETV_IF(poller->thread != NULL, PERIPHERAL_ERROR_NONE);
+
+	for (index = 0; index < poller->count; index++)
+		poller->jobs[index].next = now;
+
+	g_atomic_int_set(&poller->stop, 0);
+
+	poller->thread = g_thread_try_new("i2c-poller", __peripheral_interface_i2c_poller_run, poller, NULL);
+	RETVM_IF(poller->thread == NULL, PERIPHERAL_ERROR_IO_ERROR, "Failed to create i2c poller thread");
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_poller_stop(peripheral_i2c_poller_h poller)
+{
+	RETV_IF(poller->thread == NULL, PERIPHERAL_ERROR_NONE);
+
+	g_atomic_int_set(&poller->stop, 1);
+	g_thread_join(poller->thread);
+
+	poller->thread = NULL;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+void peripheral_interface_i2c_poller_destroy(peripheral_i2c_poller_h poller)
+{
+	int index;
+
+	peripheral_interface_i2c_poller_stop(poller);
+
+	for (index = 0; index < poller->count; index++) {
+		free(poller->jobs[index].samples);
+		free(poller->jobs[index].timestamps);
+	}
+}
+
+/*
+ * Single consumer side of a poll job.
+ */
+int peripheral_interface_i2c_poller_read_samples(peripheral_i2c_poller_h poller, int job_id, uint8_t *data, uint64_t *timestamps, int max_count, int *count)
+{
+	i2c_poll_job_s *job = &poller->jobs[job_id];
+	guint head;
+	guint tail;
+	guint index;
+	guint length;
+	guint slot;
+
+	tail = (guint)g_atomic_int_get(&job->tail);
+	head = (guint)g_atomic_int_get(&job->head);
+
+	length = MIN(head - tail, (guint)max_count);
+	for (index = 0; index < length; index++) {
+		slot = (tail + index) & (job->size - 1);
+		memcpy(data + index * job->length, job->samples + slot * job->length, job->length);
+		if (timestamps != NULL)
+			timestamps[index] = job->timestamps[slot];
+	}
+
+	g_atomic_int_set(&job->tail, (gint)(tail + length));
+
+	*count = (int)length;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static void __peripheral_interface_i2c_eeprom_address(uint8_t *buf, peripheral_i2c_address_width_e width, uint32_t offset)
+{
+	if (width == PERIPHERAL_I2C_ADDRESS_WIDTH_16) {
+		buf[0] = (offset >> 8) & 0xff;
+		buf[1] = offset & 0xff;
+	} else {
+		buf[0] = offset & 0xff;
+	}
+}
+
+/*
+ * An EEPROM does not acknowledge its address while its write cycle runs, so it is
+ * polled with zero-length writes every I2C_EEPROM_POLL_INTERVAL_US until it does.
+ * Adapters which cannot send zero-length messages are polled with one-byte reads instead.
+ */
+static int __peripheral_interface_i2c_eeprom_wait(peripheral_i2c_h i2c)
+{
+	int ret;
+	uint8_t dummy;
+	gint64 deadline = g_get_monotonic_time() + I2C_EEPROM_WRITE_TIMEOUT_US;
+	struct i2c_msg msg = { .addr = i2c->address, .flags = 0, .len = 0, .buf = &dummy };
+	struct i2c_rdwr_ioctl_data data_arg = { .msgs = &msg, .nmsgs = 1 };
+
+	while (TRUE) {
+		__peripheral_interface_i2c_bus_acquire(i2c);
+		ret = ioctl(i2c->fd, I2C_RDWR, &data_arg);
+		__peripheral_interface_i2c_bus_release(i2c);
+
+		if (ret == 1)
+			return PERIPHERAL_ERROR_NONE;
+
+		if (errno == EOPNOTSUPP && msg.len == 0) {
+			msg.flags = I2C_M_RD;
+			msg.len = 1;
+			continue;
+		}
+
+		if (g_get_monotonic_time() > deadline) {
+			_E("i2c eeprom did not finish its write cycle, errno : %d", errno);
+			return PERIPHERAL_ERROR_TRY_AGAIN;
+		}
+
+		/* A write cycle takes milliseconds, the bus is left to the others meanwhile */
+		g_usleep(I2C_EEPROM_POLL_INTERVAL_US);
+	}
+}
+
+/*
+ * Every page is written in one message and the device is polled right after it,
+ * so each page costs its actual write cycle rather than the worst case of the datasheet.
+ * The bus is not held across pages, other handles can use it during the write cycles.
+ */
+int peripheral_interface_i2c_eeprom_write(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t page_size, uint32_t offset, uint8_t *data_in, uint32_t length)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+	uint32_t done;
+	uint32_t chunk;
+	uint8_t *buf;
+	struct i2c_msg msg;
+
+	RETVM_IF(i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot write eeprom pages");
+
+	ret = __peripheral_interface_i2c_cache_invalidate(i2c, 0, I2C_REGISTER_CACHE_SIZE);
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	buf = (uint8_t *)malloc(page_size + width);
+	if (buf == NULL) {
+		_E("Failed to allocate i2c eeprom buffer");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	for (done = 0; done < length; done += chunk) {
+		chunk = MIN(length - done, page_size - (offset + done) % page_size);
+
+		__peripheral_interface_i2c_eeprom_address(buf, width, offset + done);
+		memcpy(buf + width, data_in + done, chunk);
+
+		msg.addr = i2c->address;
+		msg.flags = 0;
+		msg.len = chunk + width;
+		msg.buf = buf;
+
+		ret = peripheral_interface_i2c_transfer(i2c, &msg, 1);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			break;
+
+		ret = __peripheral_interface_i2c_eeprom_wait(i2c);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			break;
+	}
+
+	free(buf);
+
+	return ret;
+}
+
+/*
+ * The memory is read in messages of the largest size the kernel takes, each one
+ * preceded by its address, and as many of them as fit go in one I2C_RDWR.
+ */
+int peripheral_interface_i2c_eeprom_read(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t offset, uint8_t *data_out, uint32_t length)
+{
+	int ret;
+	int count = 0;
+	uint32_t done;
+	uint32_t chunk;
+	uint8_t address[I2C_RDWR_IOCTL_MAX_MSGS / 2][2];
+	struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+
+	RETVM_IF(i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot read eeprom ranges");
+
+	for (done = 0; done < length; done += chunk) {
+		chunk = MIN(length - done, I2C_RDWR_LENGTH_MAX);
+
+		__peripheral_interface_i2c_eeprom_address(address[count / 2], width, offset + done);
+
+		msgs[count].addr = i2c->address;
+		msgs[count].flags = 0;
+		msgs[count].len = width;
+		msgs[count].buf = address[count / 2];
+		msgs[count + 1].addr = i2c->address;
+		msgs[count + 1].flags = I2C_M_RD;
+		msgs[count + 1].len = chunk;
+		msgs[count + 1].buf = data_out + done;
+		count += 2;
+
+		if (count < I2C_RDWR_IOCTL_MAX_MSGS && done + chunk < length)
+			continue;
+
+		ret = peripheral_interface_i2c_transfer(i2c, msgs, count);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		count = 0;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_set_register_format(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, peripheral_i2c_endian_e endian)
+{
+	i2c->address_width = width;
+	i2c->endian = endian;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * The words are converted in place in one pass over the whole block. The loop has no
+ * dependency between iterations, so the compiler can vectorize it.
+ */
+static void __peripheral_interface_i2c_words_from_bus(peripheral_i2c_h i2c, uint16_t *data, uint32_t count)
+{
+	uint32_t index;
+	uint8_t *bytes = (uint8_t *)data;
+
+	if (i2c->endian == PERIPHERAL_I2C_ENDIAN_BIG) {
+		for (index = 0; index < count; index++)
+			data[index] = (uint16_t)(bytes[index * 2] << 8 | bytes[index * 2 + 1]);
+	} else {
+		for (index = 0; index < count; index++)
+			data[index] = (uint16_t)(bytes[index * 2] | bytes[index * 2 + 1] << 8);
+	}
+}
+
+static void __peripheral_interface_i2c_words_to_bus(peripheral_i2c_h i2c, const uint16_t *data, uint8_t *bytes, uint32_t count)
+{
+	uint32_t index;
+
+	if (i2c->endian == PERIPHERAL_I2C_ENDIAN_BIG) {
+		for (index = 0; index < count; index++) {
+			bytes[index * 2] = data[index] >> 8;
+			bytes[index * 2 + 1] = data[index] & 0xff;
+		}
+	} else {
+		for (index = 0; index < count; index++) {
+			bytes[index * 2] = data[index] & 0xff;
+			bytes[index * 2 + 1] = data[index] >> 8;
+		}
+	}
+}
+
+/*
+ * With 8-bit register addresses the words go through the register range functions,
+ * which fall back to SMBus when needed. 16-bit register addresses need plain i2c,
+ * the address and the data are sent in one I2C_RDWR with a repeated start.
+ */
+int peripheral_interface_i2c_read_register_words(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data_out, uint32_t count)
+{
+	int ret;
+	uint8_t address[2];
+
+	if (i2c->address_width == PERIPHERAL_I2C_ADDRESS_WIDTH_8) {
+		RETVM_IF(reg > 0xff, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid register for 8-bit addresses");
+		ret = peripheral_interface_i2c_read_registers(i2c, reg, (uint8_t *)data_out, count * 2);
+	} else {
+		RETVM_IF(i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot send 16-bit register addresses");
+
+		address[0] = reg >> 8;
+		address[1] = reg & 0xff;
+
+		struct i2c_msg msgs[2] = {
+			{ .addr = i2c->address, .flags = 0, .len = 2, .buf = address },
+			{ .addr = i2c->address, .flags = I2C_M_RD, .len = count * 2, .buf = (uint8_t *)data_out },
+		};
+
+		ret = peripheral_interface_i2c_transfer(i2c, msgs, 2);
+	}
+
+	if (ret != PERIPHERAL_ERROR_NONE)
+		return ret;
+
+	__peripheral_interface_i2c_words_from_bus(i2c, data_out, count);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_i2c_write_register_words(peripheral_i2c_h i2c, uint16_t reg, const uint16_t *data_in, uint32_t count)
+{
+	int ret;
+	uint8_t stack_buf[I2C_BUFFER_MAX + 2];
+	uint8_t *buf = stack_buf;
+	struct i2c_msg msg;
+
+	if (i2c->address_width == PERIPHERAL_I2C_ADDRESS_WIDTH_8)
+		RETVM_IF(reg > 0xff, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid register for 8-bit addresses");
+	else
+		RETVM_IF(i2c->path != PERIPHERAL_I2C_TRANSFER_PATH_I2C, PERIPHERAL_ERROR_NOT_SUPPORTED, "i2c adapter cannot send 16-bit register addresses");
+
+	/* The register cache only knows 8-bit addresses */
+	if (i2c->address_width != PERIPHERAL_I2C_ADDRESS_WIDTH_8) {
+		ret = __peripheral_interface_i2c_cache_invalidate(i2c, 0, I2C_REGISTER_CACHE_SIZE);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	if (count * 2 > I2C_BUFFER_MAX) {
+		buf = (uint8_t *)malloc(count * 2 + 2);
+		if (buf == NULL) {
+			_E("Failed to allocate i2c buffer");
+			return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	if (i2c->address_width == PERIPHERAL_I2C_ADDRESS_WIDTH_8) {
+		__peripheral_interface_i2c_words_to_bus(i2c, data_in, buf, count);
+		ret = peripheral_interface_i2c_write_registers(i2c, reg, buf, count * 2);
+	} else {
+		buf[0] = reg >> 8;
+		buf[1] = reg & 0xff;
+		__peripheral_interface_i2c_words_to_bus(i2c, data_in, buf + 2, count);
+
+		msg.addr = i2c->address;
+		msg.flags = 0;
+		msg.len = count * 2 + 2;
+		msg.buf = buf;
+
+		ret = peripheral_interface_i2c_transfer(i2c, &msg, 1);
+	}
+
+	if (buf != stack_buf)
+		free(buf);
+
+	return ret;
+}
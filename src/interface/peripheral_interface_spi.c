@@ -14,92 +14,532 @@
  * limitations under the License.
  */
 
+#include <stdint.h>
 #include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <sched.h>
+#include <pthread.h>
 #include <linux/spi/spidev.h>
 
 #include "peripheral_interface_spi.h"
 
+#define SPI_BUFSIZ_PATH "/sys/module/spidev/parameters/bufsiz"
+#define SPI_BUFSIZ_DEFAULT 4096
+#define SPI_TRANSFER_MIN 64
+
+#define SPI_STREAM_PRIORITY 50
+
+#ifndef SPI_TX_DUAL
+#define SPI_TX_DUAL 0x100
+#define SPI_TX_QUAD 0x200
+#define SPI_RX_DUAL 0x400
+#define SPI_RX_QUAD 0x800
+#endif
+
+#define SPI_MODE_WIDTHS (SPI_TX_DUAL | SPI_TX_QUAD | SPI_RX_DUAL | SPI_RX_QUAD)
+
+#define SPI_CACHED_MODE (1 << 0)
+#define SPI_CACHED_BITS (1 << 1)
+#define SPI_CACHED_FREQ (1 << 2)
+
+int peripheral_interface_spi_probe(peripheral_spi_h spi)
+{
+	FILE *fp;
+	unsigned int bufsiz;
+	uint8_t mode;
+
+	/* The settings the device has at open are cached, unknown ones are written on first use */
+	if (ioctl(spi->fd, SPI_IOC_RD_MODE32, &spi->mode) == 0) {
+		spi->cached |= SPI_CACHED_MODE;
+	} else if (ioctl(spi->fd, SPI_IOC_RD_MODE, &mode) == 0) {
+		spi->mode = mode;
+		spi->cached |= SPI_CACHED_MODE;
+	}
+
+	if (ioctl(spi->fd, SPI_IOC_RD_BITS_PER_WORD, &spi->bits) == 0)
+		spi->cached |= SPI_CACHED_BITS;
+	if (ioctl(spi->fd, SPI_IOC_RD_MAX_SPEED_HZ, &spi->freq) == 0)
+		spi->cached |= SPI_CACHED_FREQ;
+
+	spi->max_transfer = SPI_BUFSIZ_DEFAULT;
+
+	fp = fopen(SPI_BUFSIZ_PATH, "r");
+	if (fp == NULL) {
+		_D("Failed to read spidev bufsiz, assuming %u bytes", SPI_BUFSIZ_DEFAULT);
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	if (fscanf(fp, "%u", &bufsiz) == 1 && bufsiz >= SPI_TRANSFER_MIN)
+		spi->max_transfer = bufsiz;
+
+	fclose(fp);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
 void peripheral_interface_spi_close(peripheral_spi_h spi)
 {
+	peripheral_interface_spi_stop_stream(spi);
+
 	close(spi->fd);
 }
 
+/*
+ * The 8-bit mode ioctl clears the bus width bits, so the 32-bit one is used whenever
+ * they are set before or after, and the 8-bit one otherwise for older kernels.
+ */
+static int __peripheral_interface_spi_write_mode(peripheral_spi_h spi, uint32_t mode)
+{
+	uint8_t value = (uint8_t)mode;
+
+	if ((mode | spi->mode) & SPI_MODE_WIDTHS)
+		return ioctl(spi->fd, SPI_IOC_WR_MODE32, &mode);
+
+	return ioctl(spi->fd, SPI_IOC_WR_MODE, &value);
+}
+
+/*
+ * The settings are kept in the handle so that setting a value the device already has
+ * costs no ioctl. The mode also holds the bit order and bus widths, as it does in spidev.
+ */
 int peripheral_interface_spi_set_mode(peripheral_spi_h spi, peripheral_spi_mode_e mode)
 {
-	int ret = ioctl(spi->fd, SPI_IOC_WR_MODE, &mode);
+	int ret;
+	uint32_t value = (spi->mode & ~(SPI_CPHA | SPI_CPOL)) | mode;
+
+	RETV_IF((spi->cached & SPI_CACHED_MODE) && value == spi->mode, PERIPHERAL_ERROR_NONE);
+
+	ret = __peripheral_interface_spi_write_mode(spi, value);
 	CHECK_ERROR(ret != 0);
 
+	spi->mode = value;
+	spi->cached |= SPI_CACHED_MODE;
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
 int peripheral_interface_spi_set_bit_order(peripheral_spi_h spi, peripheral_spi_bit_order_e bit_order)
 {
-	int ret = ioctl(spi->fd, SPI_IOC_WR_LSB_FIRST, &bit_order);
+	int ret;
+	uint8_t value = (bit_order == PERIPHERAL_SPI_BIT_ORDER_LSB);
+	uint32_t mode = (spi->mode & ~SPI_LSB_FIRST) | (value ? SPI_LSB_FIRST : 0);
+
+	RETV_IF((spi->cached & SPI_CACHED_MODE) && mode == spi->mode, PERIPHERAL_ERROR_NONE);
+
+	ret = ioctl(spi->fd, SPI_IOC_WR_LSB_FIRST, &value);
 	CHECK_ERROR(ret != 0);
 
+	spi->mode = mode;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * The mode only allows the widths, the transfers ask for them with tx_nbits and rx_nbits.
+ */
+int peripheral_interface_spi_set_bus_width(peripheral_spi_h spi, peripheral_spi_bus_width_e tx_width, peripheral_spi_bus_width_e rx_width)
+{
+	int ret;
+	uint32_t mode = spi->mode & ~SPI_MODE_WIDTHS;
+
+	if (tx_width == PERIPHERAL_SPI_BUS_WIDTH_QUAD)
+		mode |= SPI_TX_QUAD;
+	else if (tx_width == PERIPHERAL_SPI_BUS_WIDTH_DUAL)
+		mode |= SPI_TX_DUAL;
+
+	if (rx_width == PERIPHERAL_SPI_BUS_WIDTH_QUAD)
+		mode |= SPI_RX_QUAD;
+	else if (rx_width == PERIPHERAL_SPI_BUS_WIDTH_DUAL)
+		mode |= SPI_RX_DUAL;
+
+	if (!(spi->cached & SPI_CACHED_MODE) || mode != spi->mode) {
+		ret = __peripheral_interface_spi_write_mode(spi, mode);
+		CHECK_ERROR(ret != 0);
+
+		/* Without dual or quad support in the controller, the kernel strips the width bits and still succeeds */
+		ret = ioctl(spi->fd, SPI_IOC_RD_MODE32, &spi->mode);
+		CHECK_ERROR(ret != 0);
+
+		spi->cached |= SPI_CACHED_MODE;
+
+		RETVM_IF((spi->mode & SPI_MODE_WIDTHS) != (mode & SPI_MODE_WIDTHS), PERIPHERAL_ERROR_NOT_SUPPORTED, "spi controller does not support the bus widths");
+	}
+
+	spi->tx_nbits = tx_width;
+	spi->rx_nbits = rx_width;
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
 int peripheral_interface_spi_set_bits_per_word(peripheral_spi_h spi, uint8_t bits)
 {
-	int ret = ioctl(spi->fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+	int ret;
+
+	RETV_IF((spi->cached & SPI_CACHED_BITS) && bits == spi->bits, PERIPHERAL_ERROR_NONE);
+
+	ret = ioctl(spi->fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
 	CHECK_ERROR(ret != 0);
 
+	spi->bits = bits;
+	spi->cached |= SPI_CACHED_BITS;
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
 int peripheral_interface_spi_set_frequency(peripheral_spi_h spi, uint32_t freq)
 {
-	int ret = ioctl(spi->fd, SPI_IOC_WR_MAX_SPEED_HZ, &freq);
+	int ret;
+
+	RETV_IF((spi->cached & SPI_CACHED_FREQ) && freq == spi->freq, PERIPHERAL_ERROR_NONE);
+
+	ret = ioctl(spi->fd, SPI_IOC_WR_MAX_SPEED_HZ, &freq);
 	CHECK_ERROR(ret != 0);
 
+	spi->freq = freq;
+	spi->cached |= SPI_CACHED_FREQ;
+
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int peripheral_interface_spi_read(peripheral_spi_h spi, uint8_t *rxbuf, uint32_t length)
+/*
+ * spidev refuses messages larger than its bufsiz, so longer transfers are split in chunks
+ * of that size, one message each. When the limit read at open is still too large for the
+ * controller, it is halved until the kernel accepts the chunks.
+ */
+static int __peripheral_interface_spi_message(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length, uint32_t speed_hz, uint8_t bits)
 {
 	int ret;
+	uint32_t offset;
+	uint32_t chunk;
 	struct spi_ioc_transfer xfer;
 
-	memset(&xfer, 0, sizeof(struct spi_ioc_transfer));
-	xfer.rx_buf = (unsigned long)rxbuf;
-	xfer.len = length;
+	for (offset = 0; offset < length; offset += chunk) {
+		chunk = MIN(length - offset, spi->max_transfer);
 
-	ret = ioctl(spi->fd, SPI_IOC_MESSAGE(1), &xfer);
-	CHECK_ERROR(ret < 0);
+		memset(&xfer, 0, sizeof(struct spi_ioc_transfer));
+		xfer.tx_buf = (txbuf != NULL) ? (unsigned long)(txbuf + offset) : 0;
+		xfer.rx_buf = (rxbuf != NULL) ? (unsigned long)(rxbuf + offset) : 0;
+		xfer.len = chunk;
+		xfer.speed_hz = speed_hz;
+		xfer.bits_per_word = bits;
+		xfer.tx_nbits = spi->tx_nbits;
+		xfer.rx_nbits = spi->rx_nbits;
+
+		/* On the last transfer of a message, cs_change keeps the chip selected until the next message */
+		xfer.cs_change = (spi->cs_hold && offset + chunk < length);
+
+		ret = ioctl(spi->fd, SPI_IOC_MESSAGE(1), &xfer);
+		if (ret < 0 && errno == EMSGSIZE && spi->max_transfer > SPI_TRANSFER_MIN) {
+			spi->max_transfer /= 2;
+			_D("spi transfer limit lowered to %u bytes", spi->max_transfer);
+			chunk = 0;
+			continue;
+		}
+		CHECK_ERROR(ret < 0);
+	}
 
 	return PERIPHERAL_ERROR_NONE;
 }
 
+int peripheral_interface_spi_read(peripheral_spi_h spi, uint8_t *rxbuf, uint32_t length)
+{
+	return __peripheral_interface_spi_message(spi, NULL, rxbuf, length, 0, 0);
+}
+
 int peripheral_interface_spi_write(peripheral_spi_h spi, uint8_t *txbuf, uint32_t length)
+{
+	return __peripheral_interface_spi_message(spi, txbuf, NULL, length, 0, 0);
+}
+
+int peripheral_interface_spi_transfer(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length)
+{
+	if (!txbuf || !rxbuf) return PERIPHERAL_ERROR_INVALID_PARAMETER;
+
+	return __peripheral_interface_spi_message(spi, txbuf, rxbuf, length, 0, 0);
+}
+
+/*
+ * The speed and word size of the call go in the transfers themselves,
+ * the settings of the handle are left as they are.
+ */
+int peripheral_interface_spi_transfer_with_settings(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length, uint32_t speed_hz, uint8_t bits)
+{
+	return __peripheral_interface_spi_message(spi, txbuf, rxbuf, length, speed_hz, bits);
+}
+
+int peripheral_interface_spi_transfer_segments(peripheral_spi_h spi, peripheral_spi_segment_s *segments, int count)
 {
 	int ret;
-	struct spi_ioc_transfer xfer;
+	int index;
+	struct spi_ioc_transfer *xfers;
+
+	xfers = (struct spi_ioc_transfer *)calloc(count, sizeof(struct spi_ioc_transfer));
+	if (xfers == NULL) {
+		_E("Failed to allocate spi transfers");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	for (index = 0; index < count; index++) {
+		xfers[index].tx_buf = (unsigned long)segments[index].txdata;
+		xfers[index].rx_buf = (unsigned long)segments[index].rxdata;
+		xfers[index].len = segments[index].length;
+		xfers[index].speed_hz = segments[index].speed_hz;
+		xfers[index].delay_usecs = segments[index].delay_usecs;
+		xfers[index].bits_per_word = segments[index].bits_per_word;
+		xfers[index].cs_change = segments[index].cs_change;
+		xfers[index].tx_nbits = segments[index].tx_nbits ? segments[index].tx_nbits : spi->tx_nbits;
+		xfers[index].rx_nbits = segments[index].rx_nbits ? segments[index].rx_nbits : spi->rx_nbits;
+	}
+
+	ret = ioctl(spi->fd, SPI_IOC_MESSAGE(count), xfers);
 
-	memset(&xfer, 0, sizeof(struct spi_ioc_transfer));
-	xfer.tx_buf = (unsigned long)txbuf;
-	xfer.len = length;
+	free(xfers);
 
-	ret = ioctl(spi->fd, SPI_IOC_MESSAGE(1), &xfer);
 	CHECK_ERROR(ret < 0);
 
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int peripheral_interface_spi_transfer(peripheral_spi_h spi, uint8_t *txbuf, uint8_t *rxbuf, uint32_t length)
+int peripheral_interface_spi_set_chunk_cs_hold(peripheral_spi_h spi, bool hold)
+{
+	spi->cs_hold = hold;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_spi_get_max_transfer_size(peripheral_spi_h spi, uint32_t *size)
+{
+	*size = spi->max_transfer;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static void __peripheral_interface_spi_stream_free(spi_stream_s *stream)
+{
+	if (stream->event_fd >= 0)
+		close(stream->event_fd);
+
+	free(stream->txdata);
+	free(stream->blocks);
+	free(stream->scratch);
+	free(stream);
+}
+
+/*
+ * A failed stream wakes up the consumer polling the fd, so that peripheral_spi_read_stream() reports the error.
+ */
+static void __peripheral_interface_spi_stream_fail(spi_stream_s *stream, int error)
+{
+	uint64_t one = 1;
+
+	g_atomic_int_set(&stream->error, error);
+
+	if (stream->event_fd >= 0 && write(stream->event_fd, &one, sizeof(one)) != sizeof(one))
+		_E("Failed to signal spi stream error, errno : %d", errno);
+}
+
+/*
+ * Every block is one message of frames, with a chip select toggle between the frames,
+ * and the messages are issued back to back. When the consumer has not taken the blocks
+ * in time, the block is read into a scratch buffer and counted as an overrun, so that
+ * the sampling of the device stays regular.
+ */
+static gpointer __peripheral_interface_spi_stream_run(gpointer data)
 {
 	int ret;
-	struct spi_ioc_transfer xfer;
+	int index;
+	guint head;
+	guint tail;
+	uint8_t *block;
+	uint64_t one = 1;
+	peripheral_spi_h spi = (peripheral_spi_h)data;
+	spi_stream_s *stream = spi->stream;
+	struct spi_ioc_transfer *xfers;
+	struct sched_param param = { .sched_priority = SPI_STREAM_PRIORITY };
 
-	if (!txbuf || !rxbuf) return PERIPHERAL_ERROR_INVALID_PARAMETER;
+	if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0)
+		_D("Failed to set real-time priority of the spi stream thread");
 
-	memset(&xfer, 0, sizeof(xfer));
-	xfer.tx_buf = (unsigned long)txbuf;
-	xfer.rx_buf = (unsigned long)rxbuf;
-	xfer.len = length;
+	xfers = (struct spi_ioc_transfer *)calloc(stream->frames, sizeof(struct spi_ioc_transfer));
+	if (xfers == NULL) {
+		_E("Failed to allocate spi stream transfers");
+		__peripheral_interface_spi_stream_fail(stream, PERIPHERAL_ERROR_OUT_OF_MEMORY);
+		return NULL;
+	}
 
-	ret = ioctl(spi->fd, SPI_IOC_MESSAGE(1), &xfer);
-	CHECK_ERROR(ret < 0);
+	for (index = 0; index < stream->frames; index++) {
+		xfers[index].tx_buf = (unsigned long)stream->txdata;
+		xfers[index].len = stream->frame_size;
+		xfers[index].cs_change = (index < stream->frames - 1);
+		xfers[index].tx_nbits = spi->tx_nbits;
+		xfers[index].rx_nbits = spi->rx_nbits;
+	}
+
+	while (!g_atomic_int_get(&stream->stop)) {
+		head = (guint)g_atomic_int_get(&stream->head);
+		tail = (guint)g_atomic_int_get(&stream->tail);
+
+		if (stream->callback != NULL || head - tail < stream->count) {
+			block = stream->blocks + (head & (stream->count - 1)) * stream->block_size;
+		} else {
+			block = stream->scratch;
+			g_atomic_int_inc(&stream->overruns);
+		}
+
+		for (index = 0; index < stream->frames; index++)
+			xfers[index].rx_buf = (unsigned long)(block + index * stream->frame_size);
+
+		ret = ioctl(spi->fd, SPI_IOC_MESSAGE(stream->frames), xfers);
+		if (ret < 0) {
+			_E("Failed to transfer spi stream block, errno : %d", errno);
+			__peripheral_interface_spi_stream_fail(stream, PERIPHERAL_ERROR_IO_ERROR);
+			break;
+		}
+
+		if (block == stream->scratch)
+			continue;
+
+		if (stream->callback != NULL) {
+			stream->callback(spi, block, stream->block_size, stream->user_data);
+			continue;
+		}
+
+		g_atomic_int_set(&stream->head, (gint)(head + 1));
+
+		if (write(stream->event_fd, &one, sizeof(one)) != sizeof(one))
+			_E("Failed to signal spi stream block, errno : %d", errno);
+	}
+
+	free(xfers);
+
+	return NULL;
+}
+
+int peripheral_interface_spi_start_stream(peripheral_spi_h spi, uint8_t *txdata, uint32_t frame_size, int frames, int count, peripheral_spi_stream_cb callback, void *user_data)
+{
+	spi_stream_s *stream;
+	uint32_t block_size;
+	guint capacity = 1;
+
+	/* The ring is indexed with a mask, so its capacity is rounded up to a power of two */
+	while (capacity < (guint)count)
+		capacity <<= 1;
+
+	RETVM_IF(spi->stream != NULL, PERIPHERAL_ERROR_RESOURCE_BUSY, "spi stream is running");
+	RETVM_IF((uint64_t)frame_size * frames > spi->max_transfer, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi stream block is larger than %u bytes", spi->max_transfer);
+	RETVM_IF((uint64_t)frame_size * frames * capacity > SIZE_MAX, PERIPHERAL_ERROR_OUT_OF_MEMORY, "spi stream ring is too large");
+
+	block_size = frame_size * frames;
+
+	stream = (spi_stream_s *)calloc(1, sizeof(spi_stream_s));
+	if (stream == NULL) {
+		_E("Failed to allocate spi stream");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	stream->event_fd = -1;
+	stream->txdata = (uint8_t *)calloc(1, frame_size);
+	stream->blocks = (uint8_t *)malloc((size_t)block_size * capacity);
+	stream->scratch = (uint8_t *)malloc(block_size);
+	if (stream->txdata == NULL || stream->blocks == NULL || stream->scratch == NULL) {
+		_E("Failed to allocate spi stream buffers");
+		__peripheral_interface_spi_stream_free(stream);
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	if (callback == NULL) {
+		stream->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (stream->event_fd < 0) {
+			_E("Failed to create spi stream eventfd, errno : %d", errno);
+			__peripheral_interface_spi_stream_free(stream);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+	}
+
+	if (txdata != NULL)
+		memcpy(stream->txdata, txdata, frame_size);
+
+	stream->frame_size = frame_size;
+	stream->frames = frames;
+	stream->block_size = block_size;
+	stream->count = capacity;
+	stream->callback = callback;
+	stream->user_data = user_data;
+
+	spi->stream = stream;
+
+	stream->thread = g_thread_try_new("spi-stream", __peripheral_interface_spi_stream_run, spi, NULL);
+	if (stream->thread == NULL) {
+		_E("Failed to create spi stream thread");
+		spi->stream = NULL;
+		__peripheral_interface_spi_stream_free(stream);
+		return PERIPHERAL_ERROR_IO_ERROR;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_spi_stop_stream(peripheral_spi_h spi)
+{
+	int ret;
+	spi_stream_s *stream = spi->stream;
+
+	RETV_IF(stream == NULL, PERIPHERAL_ERROR_NONE);
+
+	g_atomic_int_set(&stream->stop, 1);
+	g_thread_join(stream->thread);
+
+	ret = g_atomic_int_get(&stream->error);
+
+	spi->stream = NULL;
+	__peripheral_interface_spi_stream_free(stream);
+
+	return ret;
+}
+
+int peripheral_interface_spi_get_stream_fd(peripheral_spi_h spi, int *fd)
+{
+	spi_stream_s *stream = spi->stream;
+
+	RETVM_IF(stream == NULL || stream->event_fd < 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi stream has no fd");
+
+	*fd = stream->event_fd;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/*
+ * Single consumer side of the stream.
+ */
+int peripheral_interface_spi_read_stream(peripheral_spi_h spi, uint8_t *data, uint32_t length)
+{
+	int ret;
+	guint head;
+	guint tail;
+	spi_stream_s *stream = spi->stream;
+
+	RETVM_IF(stream == NULL || stream->callback != NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi stream is not read by blocks");
+	RETVM_IF(length < stream->block_size, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi stream blocks are %u bytes", stream->block_size);
+	ret = g_atomic_int_get(&stream->error);
+	RETV_IF(ret != PERIPHERAL_ERROR_NONE, ret);
+
+	tail = (guint)g_atomic_int_get(&stream->tail);
+	head = (guint)g_atomic_int_get(&stream->head);
+
+	RETV_IF(head == tail, PERIPHERAL_ERROR_TRY_AGAIN);
+
+	memcpy(data, stream->blocks + (tail & (stream->count - 1)) * stream->block_size, stream->block_size);
+
+	g_atomic_int_set(&stream->tail, (gint)(tail + 1));
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_interface_spi_get_stream_overruns(peripheral_spi_h spi, uint32_t *overruns)
+{
+	RETVM_IF(spi->stream == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi stream is not running");
+
+	*overruns = (uint32_t)g_atomic_int_get(&spi->stream->overruns);
 
 	return PERIPHERAL_ERROR_NONE;
 }
@@ -29,6 +29,12 @@
 #define GPIO_FEATURE_FALSE    0
 #define GPIO_FEATURE_TRUE     1
 
+#define GPIO_EVENT_QUEUE_MAX 65536
+#define GPIO_DEBOUNCE_MAX_US 1000000
+#define GPIO_COUNTER_WINDOW_MAX_MS 60000
+
+#define GPIO_PORT_MASK(count) (((count) == GPIO_PORT_LINES_MAX) ? ~0ULL : ((1ULL << (count)) - 1))
+
 static int gpio_feature = GPIO_FEATURE_UNKNOWN;
 
 static bool __is_feature_supported(void)
@@ -64,6 +70,13 @@ int peripheral_gpio_open(int gpio_pin, peripheral_gpio_h *gpio)
 		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
 	}
 
+	/* Prefer the gpiochip character device, sysfs is used when it is not available */
+	ret = peripheral_interface_gpio_open_chardev(handle, gpio_pin);
+	if (ret == PERIPHERAL_ERROR_NONE) {
+		*gpio = handle;
+		return PERIPHERAL_ERROR_NONE;
+	}
+
 	ret = peripheral_gdbus_gpio_open(handle, gpio_pin);
 	if (ret != PERIPHERAL_ERROR_NONE) {
 		_E("Failed to open the gpio pin, ret : %d", ret);
@@ -86,7 +99,6 @@ int peripheral_gpio_open(int gpio_pin, peripheral_gpio_h *gpio)
 		return ret;
 	}
 
-	handle->cb_info.thread = NULL;
 	*gpio = handle;
 
 	return PERIPHERAL_ERROR_NONE;
@@ -104,9 +116,11 @@ int peripheral_gpio_close(peripheral_gpio_h gpio)
 	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
 
 	/* call gpio_close */
-	ret = peripheral_gdbus_gpio_close(gpio);
-	if (ret != PERIPHERAL_ERROR_NONE)
-		_E("Failed to close the gpio pin, ret : %d", ret);
+	if (gpio->backend == GPIO_BACKEND_SYSFS) {
+		ret = peripheral_gdbus_gpio_close(gpio);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			_E("Failed to close the gpio pin, ret : %d", ret);
+	}
 
 	peripheral_interface_gpio_close(gpio);
 
@@ -145,15 +159,11 @@ int peripheral_gpio_set_edge_mode(peripheral_gpio_h gpio, peripheral_gpio_edge_e
  */
 int peripheral_gpio_set_interrupted_cb(peripheral_gpio_h gpio, peripheral_gpio_interrupted_cb callback, void *user_data)
 {
-	int ret = PERIPHERAL_ERROR_NONE;
-
 	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
 	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
 	RETVM_IF(callback == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio interrupted callback is NULL");
 
-	peripheral_interface_gpio_set_interrupted_cb(gpio, callback, user_data);
-
-	return ret;
+	return peripheral_interface_gpio_set_interrupted_cb(gpio, callback, user_data);
 }
 
 /**
@@ -171,6 +181,152 @@ int peripheral_gpio_unset_interrupted_cb(peripheral_gpio_h gpio)
 	return ret;
 }
 
+/**
+ * @brief Sets how the interrupted callback of the gpio is delivered.
+ */
+int peripheral_gpio_set_interrupted_cb_delivery(peripheral_gpio_h gpio, peripheral_gpio_callback_delivery_e delivery, void *main_context)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF((delivery < PERIPHERAL_GPIO_CALLBACK_DELIVERY_MAIN_LOOP) || (delivery > PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT), PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio callback delivery is invalid");
+
+	return peripheral_interface_gpio_set_interrupted_cb_delivery(gpio, delivery, main_context);
+}
+
+/**
+ * @brief Starts recording the edges of the gpio into an event queue.
+ */
+int peripheral_gpio_set_event_queue(peripheral_gpio_h gpio, int size)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(size <= 0 || size > GPIO_EVENT_QUEUE_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio event queue size is invalid");
+
+	return peripheral_interface_gpio_set_event_queue(gpio, size);
+}
+
+/**
+ * @brief Stops recording the edges of the gpio and releases the event queue.
+ */
+int peripheral_gpio_unset_event_queue(peripheral_gpio_h gpio)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+
+	return peripheral_interface_gpio_unset_event_queue(gpio);
+}
+
+/**
+ * @brief Takes the recorded edges out of the event queue of the gpio.
+ */
+int peripheral_gpio_read_events(peripheral_gpio_h gpio, peripheral_gpio_event_s *events, int max_count, int *count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(events == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio events is NULL");
+	RETVM_IF(max_count <= 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio max_count is invalid");
+	RETVM_IF(count == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio count is NULL");
+
+	return peripheral_interface_gpio_read_events(gpio, events, max_count, count);
+}
+
+/**
+ * @brief Sets the debounce and glitch filter of the gpio edges.
+ */
+int peripheral_gpio_set_debounce(peripheral_gpio_h gpio, uint32_t stable_time_us, uint32_t min_pulse_width_us)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(stable_time_us > GPIO_DEBOUNCE_MAX_US, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio stable time is invalid");
+	RETVM_IF(min_pulse_width_us > GPIO_DEBOUNCE_MAX_US, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio min pulse width is invalid");
+
+	return peripheral_interface_gpio_set_debounce(gpio, stable_time_us, min_pulse_width_us);
+}
+
+/**
+ * @brief Starts counting the edges of the gpio.
+ */
+int peripheral_gpio_set_edge_counter(peripheral_gpio_h gpio, uint32_t window_ms)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(window_ms == 0 || window_ms > GPIO_COUNTER_WINDOW_MAX_MS, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio counter window is invalid");
+
+	return peripheral_interface_gpio_set_edge_counter(gpio, window_ms);
+}
+
+/**
+ * @brief Stops counting the edges of the gpio.
+ */
+int peripheral_gpio_unset_edge_counter(peripheral_gpio_h gpio)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+
+	return peripheral_interface_gpio_unset_edge_counter(gpio);
+}
+
+/**
+ * @brief Gets the number of edges counted on the gpio.
+ */
+int peripheral_gpio_get_edge_count(peripheral_gpio_h gpio, uint64_t *count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(count == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio count is NULL");
+
+	return peripheral_interface_gpio_get_edge_count(gpio, count);
+}
+
+/**
+ * @brief Gets the rate of the edges counted on the gpio.
+ */
+int peripheral_gpio_get_edge_frequency(peripheral_gpio_h gpio, double *frequency)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(frequency == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio frequency is NULL");
+
+	return peripheral_interface_gpio_get_edge_frequency(gpio, frequency);
+}
+
+/**
+ * @brief Starts measuring the pulses of the gpio.
+ */
+int peripheral_gpio_set_pulse_capture(peripheral_gpio_h gpio, int size)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(size <= 0 || size > GPIO_EVENT_QUEUE_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio pulse capture size is invalid");
+
+	return peripheral_interface_gpio_set_pulse_capture(gpio, size);
+}
+
+/**
+ * @brief Stops measuring the pulses of the gpio.
+ */
+int peripheral_gpio_unset_pulse_capture(peripheral_gpio_h gpio)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+
+	return peripheral_interface_gpio_unset_pulse_capture(gpio);
+}
+
+/**
+ * @brief Takes the measured pulses out of the capture of the gpio.
+ */
+int peripheral_gpio_read_pulses(peripheral_gpio_h gpio, peripheral_gpio_pulse_s *pulses, int max_count, int *count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(gpio == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio handle is NULL");
+	RETVM_IF(pulses == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio pulses is NULL");
+	RETVM_IF(max_count <= 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio max_count is invalid");
+	RETVM_IF(count == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio count is NULL");
+
+	return peripheral_interface_gpio_read_pulses(gpio, pulses, max_count, count);
+}
+
 /**
  * @brief Reads value of the gpio.
  */
@@ -194,3 +350,166 @@ int peripheral_gpio_write(peripheral_gpio_h gpio, uint32_t value)
 
 	return peripheral_interface_gpio_write(gpio, value);
 }
+
+/**
+ * @brief Initializes(export) gpio pins and creates gpio port handle.
+ */
+int peripheral_gpio_port_open(int *pins, int count, peripheral_gpio_port_h *port)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+	int index;
+	peripheral_gpio_port_h handle;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid gpio port handle");
+	RETVM_IF(pins == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid gpio pins");
+	RETVM_IF(count <= 0 || count > GPIO_PORT_LINES_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid gpio pin count");
+
+	for (index = 0; index < count; index++)
+		RETVM_IF(pins[index] < 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid gpio pin number");
+
+	/* Initialize */
+	handle = (peripheral_gpio_port_h)calloc(1, sizeof(struct _peripheral_gpio_port_s));
+	if (handle == NULL) {
+		_E("Failed to allocate peripheral_gpio_port_h");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	handle->count = count;
+
+	/* Pins on a single gpiochip share one line request, otherwise each pin is opened on its own */
+	ret = peripheral_interface_gpio_port_open_chardev(handle, pins, count);
+	if (ret == PERIPHERAL_ERROR_NONE) {
+		*port = handle;
+		return PERIPHERAL_ERROR_NONE;
+	}
+
+	for (index = 0; index < count; index++) {
+		ret = peripheral_gpio_open(pins[index], &handle->gpio[index]);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			_E("Failed to open the gpio pin %d of the port, ret : %d", pins[index], ret);
+			peripheral_gpio_port_close(handle);
+			return ret;
+		}
+	}
+
+	*port = handle;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+/**
+ * @brief Releases the gpio port handle and finalize(unexport) the gpio pins.
+ */
+int peripheral_gpio_port_close(peripheral_gpio_port_h port)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+	int index;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+
+	peripheral_interface_gpio_port_stop_waveform(port);
+
+	if (port->backend == GPIO_BACKEND_CHARDEV) {
+		peripheral_interface_gpio_port_close(port);
+	} else {
+		for (index = 0; index < port->count; index++) {
+			if (port->gpio[index] == NULL)
+				continue;
+
+			if (peripheral_gpio_close(port->gpio[index]) != PERIPHERAL_ERROR_NONE)
+				ret = PERIPHERAL_ERROR_IO_ERROR;
+		}
+	}
+
+	free(port);
+	port = NULL;
+
+	return ret;
+}
+
+/**
+ * @brief Sets direction of the gpio pins selected by mask.
+ */
+int peripheral_gpio_port_set_direction(peripheral_gpio_port_h port, uint64_t mask, peripheral_gpio_direction_e direction)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+	RETVM_IF(mask == 0 || (mask & ~GPIO_PORT_MASK(port->count)), PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port mask is invalid");
+	RETVM_IF((direction < PERIPHERAL_GPIO_DIRECTION_IN) || (direction > PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid direction input");
+
+	return peripheral_interface_gpio_port_set_direction(port, mask, direction);
+}
+
+/**
+ * @brief Reads values of the gpio pins selected by mask.
+ */
+int peripheral_gpio_port_read_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t *bits)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+	RETVM_IF(mask == 0 || (mask & ~GPIO_PORT_MASK(port->count)), PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port mask is invalid");
+	RETVM_IF(bits == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port read bits is invalid");
+
+	return peripheral_interface_gpio_port_read_mask(port, mask, bits);
+}
+
+/**
+ * @brief Writes values to the gpio pins selected by mask.
+ */
+int peripheral_gpio_port_write_mask(peripheral_gpio_port_h port, uint64_t mask, uint64_t bits)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+	RETVM_IF(mask == 0 || (mask & ~GPIO_PORT_MASK(port->count)), PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port mask is invalid");
+
+	return peripheral_interface_gpio_port_write_mask(port, mask, bits);
+}
+
+/**
+ * @brief Starts playing a waveform on the gpio pins of the port.
+ */
+int peripheral_gpio_port_start_waveform(peripheral_gpio_port_h port, const peripheral_gpio_waveform_step_s *steps, int count, int repeat)
+{
+	int index;
+	uint64_t period = 0;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+	RETVM_IF(steps == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio waveform steps is NULL");
+	RETVM_IF(count <= 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio waveform count is invalid");
+	RETVM_IF(repeat < 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio waveform repeat is invalid");
+
+	for (index = 0; index < count; index++) {
+		RETVM_IF(steps[index].mask == 0 || (steps[index].mask & ~GPIO_PORT_MASK(port->count)), PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio waveform step mask is invalid");
+		period += steps[index].delay_ns;
+	}
+
+	/* Played forever without any delay, the real-time thread would never sleep */
+	RETVM_IF(repeat == 0 && period == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio waveform played forever has no delay");
+
+	return peripheral_interface_gpio_port_start_waveform(port, steps, count, repeat);
+}
+
+/**
+ * @brief Waits until the waveform of the port has been played.
+ */
+int peripheral_gpio_port_wait_waveform(peripheral_gpio_port_h port)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+
+	return peripheral_interface_gpio_port_wait_waveform(port);
+}
+
+/**
+ * @brief Stops the waveform of the port.
+ */
+int peripheral_gpio_port_stop_waveform(peripheral_gpio_port_h port)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "GPIO feature is not supported");
+	RETVM_IF(port == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "gpio port handle is NULL");
+
+	return peripheral_interface_gpio_port_stop_waveform(port);
+}
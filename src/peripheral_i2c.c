@@ -39,6 +39,18 @@
 #define I2C_SMBUS_BYTE_DATA	    2
 #define I2C_SMBUS_WORD_DATA	    3
 
+#define I2C_PRIORITY_MAX 99
+#define I2C_POLL_PERIOD_MIN 100
+#define I2C_POLL_PERIOD_MAX 60000000
+#define I2C_POLL_SAMPLES_MAX 65536
+#define I2C_EEPROM_PAGE_MAX 4096
+#define I2C_WORDS_READ_MAX (I2C_RDWR_LENGTH_MAX / 2)
+#define I2C_WORDS_WRITE_MAX (I2C_RDWR_LENGTH_MAX / 2 - 1)
+#define I2C_ADDRESS_SPACE(width) (1ULL << ((width) * 8))
+#define I2C_REGISTER_SPACE 256
+
+#define I2C_MESSAGE_FLAG_ALL (PERIPHERAL_I2C_MESSAGE_FLAG_NO_START | PERIPHERAL_I2C_MESSAGE_FLAG_IGNORE_NAK | PERIPHERAL_I2C_MESSAGE_FLAG_STOP)
+
 static int i2c_feature = I2C_FEATURE_UNKNOWN;
 
 static bool __is_feature_supported(void)
@@ -65,7 +77,7 @@ int peripheral_i2c_open(int bus, int address, peripheral_i2c_h *i2c)
 	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid i2c handle");
 	RETVM_IF(bus < 0 || address < 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
 
-	handle = (peripheral_i2c_h)malloc(sizeof(struct _peripheral_i2c_s));
+	handle = (peripheral_i2c_h)calloc(1, sizeof(struct _peripheral_i2c_s));
 	if (handle == NULL) {
 		_E("Failed to allocate peripheral_i2c_h");
 		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
@@ -76,6 +88,17 @@ int peripheral_i2c_open(int bus, int address, peripheral_i2c_h *i2c)
 		_E("Failed to open i2c communication, ret : %d", ret);
 		free(handle);
 		handle = NULL;
+	} else {
+		handle->bus = bus;
+		handle->address = address;
+		handle->event_fd = -1;
+		handle->address_width = PERIPHERAL_I2C_ADDRESS_WIDTH_8;
+		handle->endian = PERIPHERAL_I2C_ENDIAN_LITTLE;
+		peripheral_interface_i2c_probe(handle);
+
+		/* Without an arbiter the handle still works, only without bus scheduling */
+		if (peripheral_interface_i2c_attach_bus(handle) != PERIPHERAL_ERROR_NONE)
+			_E("Failed to attach i2c bus arbiter");
 	}
 
 	*i2c = handle;
@@ -155,3 +178,407 @@ int peripheral_i2c_write_register_word(peripheral_i2c_h i2c, uint8_t reg, uint16
 
 	return peripheral_interface_i2c_write_register_word(i2c, reg, data);
 }
+
+int peripheral_i2c_read_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length > I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_read_registers(i2c, reg, data, length);
+}
+
+int peripheral_i2c_write_registers(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length >= I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_write_registers(i2c, reg, data, length);
+}
+
+int peripheral_i2c_read_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t *length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL || length == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(*length == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_read_block_data(i2c, reg, data, length);
+}
+
+int peripheral_i2c_write_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length > I2C_SMBUS_BLOCK_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_write_block_data(i2c, reg, data, length);
+}
+
+int peripheral_i2c_read_i2c_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || reg + length > I2C_REGISTER_SPACE, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_read_i2c_block(i2c, reg, data, length);
+}
+
+int peripheral_i2c_write_i2c_block_data(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || reg + length > I2C_REGISTER_SPACE, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_write_i2c_block(i2c, reg, data, length);
+}
+
+int peripheral_i2c_transaction_create(peripheral_i2c_h i2c, peripheral_i2c_transaction_h *transaction)
+{
+	peripheral_i2c_transaction_h handle;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid i2c transaction handle");
+
+	handle = (peripheral_i2c_transaction_h)calloc(1, sizeof(struct _peripheral_i2c_transaction_s));
+	if (handle == NULL) {
+		_E("Failed to allocate peripheral_i2c_transaction_h");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	handle->i2c = i2c;
+
+	*transaction = handle;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_i2c_transaction_destroy(peripheral_i2c_transaction_h transaction)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction handle is NULL");
+
+	free(transaction);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+static int __peripheral_i2c_transaction_add(peripheral_i2c_transaction_h transaction, uint8_t *data, uint32_t length, int flags, bool read)
+{
+	i2c_transaction_msg_s *msg;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length > I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+	RETVM_IF(flags & ~I2C_MESSAGE_FLAG_ALL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid flags");
+	RETVM_IF(transaction->count >= I2C_TRANSACTION_MSGS_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction is full");
+
+	msg = &transaction->msgs[transaction->count++];
+	msg->buf = data;
+	msg->len = (uint16_t)length;
+	msg->read = read;
+	msg->flags = flags;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_i2c_transaction_add_write(peripheral_i2c_transaction_h transaction, uint8_t *data, uint32_t length, int flags)
+{
+	return __peripheral_i2c_transaction_add(transaction, data, length, flags, false);
+}
+
+int peripheral_i2c_transaction_add_read(peripheral_i2c_transaction_h transaction, uint8_t *data, uint32_t length, int flags)
+{
+	return __peripheral_i2c_transaction_add(transaction, data, length, flags, true);
+}
+
+int peripheral_i2c_transaction_submit(peripheral_i2c_transaction_h transaction)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction handle is NULL");
+	RETVM_IF(transaction->count == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction is empty");
+
+	return peripheral_interface_i2c_transaction_submit(transaction);
+}
+
+int peripheral_i2c_transaction_reset(peripheral_i2c_transaction_h transaction)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction handle is NULL");
+
+	transaction->count = 0;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_i2c_get_transfer_path(peripheral_i2c_h i2c, peripheral_i2c_transfer_path_e *path)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(path == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_get_transfer_path(i2c, path);
+}
+
+int peripheral_i2c_set_register_cacheable(peripheral_i2c_h i2c, uint8_t reg, bool cacheable)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_set_register_cacheable(i2c, reg, cacheable);
+}
+
+int peripheral_i2c_set_register_cache_mode(peripheral_i2c_h i2c, peripheral_i2c_register_cache_mode_e mode)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF((mode < PERIPHERAL_I2C_REGISTER_CACHE_WRITE_THROUGH) || (mode > PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid cache mode");
+
+	return peripheral_interface_i2c_set_register_cache_mode(i2c, mode);
+}
+
+int peripheral_i2c_update_register_bits(peripheral_i2c_h i2c, uint8_t reg, uint8_t mask, uint8_t value)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_update_register_bits(i2c, reg, mask, value);
+}
+
+int peripheral_i2c_sync_registers(peripheral_i2c_h i2c)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_sync_registers(i2c);
+}
+
+int peripheral_i2c_invalidate_register_cache(peripheral_i2c_h i2c)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_invalidate_register_cache(i2c);
+}
+
+int peripheral_i2c_read_async(peripheral_i2c_h i2c, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_read_async(i2c, data, length, callback, user_data);
+}
+
+int peripheral_i2c_write_async(peripheral_i2c_h i2c, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_write_async(i2c, data, length, callback, user_data);
+}
+
+int peripheral_i2c_read_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length > I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_read_registers_async(i2c, reg, data, length, callback, user_data);
+}
+
+int peripheral_i2c_write_registers_async(peripheral_i2c_h i2c, uint8_t reg, uint8_t *data, uint32_t length, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || length >= I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+
+	return peripheral_interface_i2c_write_registers_async(i2c, reg, data, length, callback, user_data);
+}
+
+int peripheral_i2c_transaction_submit_async(peripheral_i2c_transaction_h transaction, peripheral_i2c_completed_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(transaction == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction handle is NULL");
+	RETVM_IF(transaction->count == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c transaction is empty");
+
+	return peripheral_interface_i2c_transaction_submit_async(transaction, callback, user_data);
+}
+
+int peripheral_i2c_get_completion_fd(peripheral_i2c_h i2c, int *fd)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(fd == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_get_completion_fd(i2c, fd);
+}
+
+int peripheral_i2c_set_priority(peripheral_i2c_h i2c, int priority)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(priority < 0 || priority > I2C_PRIORITY_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid priority");
+
+	return peripheral_interface_i2c_set_priority(i2c, priority);
+}
+
+int peripheral_i2c_set_max_hold_time(peripheral_i2c_h i2c, uint32_t hold_time_us)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_set_max_hold_time(i2c, hold_time_us);
+}
+
+int peripheral_i2c_poller_create(peripheral_i2c_poller_h *poller)
+{
+	peripheral_i2c_poller_h handle;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid i2c poller handle");
+
+	handle = (peripheral_i2c_poller_h)calloc(1, sizeof(struct _peripheral_i2c_poller_s));
+	if (handle == NULL) {
+		_E("Failed to allocate peripheral_i2c_poller_h");
+		return PERIPHERAL_ERROR_OUT_OF_MEMORY;
+	}
+
+	*poller = handle;
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_i2c_poller_destroy(peripheral_i2c_poller_h poller)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller handle is NULL");
+
+	peripheral_interface_i2c_poller_destroy(poller);
+
+	free(poller);
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int peripheral_i2c_poller_add_job(peripheral_i2c_poller_h poller, peripheral_i2c_h i2c, uint8_t reg, uint32_t length, uint32_t period_us, int size, int *job)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller handle is NULL");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(length == 0 || length > I2C_RDWR_LENGTH_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length");
+	RETVM_IF(period_us < I2C_POLL_PERIOD_MIN || period_us > I2C_POLL_PERIOD_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid period");
+	RETVM_IF(size <= 0 || size > I2C_POLL_SAMPLES_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid size");
+	RETVM_IF(job == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_poller_add_job(poller, i2c, reg, length, period_us, size, job);
+}
+
+int peripheral_i2c_poller_start(peripheral_i2c_poller_h poller)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller handle is NULL");
+	RETVM_IF(poller->count == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller has no job");
+
+	return peripheral_interface_i2c_poller_start(poller);
+}
+
+int peripheral_i2c_poller_stop(peripheral_i2c_poller_h poller)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller handle is NULL");
+
+	return peripheral_interface_i2c_poller_stop(poller);
+}
+
+int peripheral_i2c_poller_read_samples(peripheral_i2c_poller_h poller, int job, uint8_t *data, uint64_t *timestamps, int max_count, int *count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(poller == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c poller handle is NULL");
+	RETVM_IF(job < 0 || job >= poller->count, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid job");
+	RETVM_IF(data == NULL || count == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(max_count <= 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid max_count");
+
+	return peripheral_interface_i2c_poller_read_samples(poller, job, data, timestamps, max_count, count);
+}
+
+int peripheral_i2c_eeprom_write(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t page_size, uint32_t offset, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(width != PERIPHERAL_I2C_ADDRESS_WIDTH_8 && width != PERIPHERAL_I2C_ADDRESS_WIDTH_16, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid address width");
+	RETVM_IF(page_size == 0 || page_size > I2C_EEPROM_PAGE_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid page size");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || (uint64_t)offset + length > I2C_ADDRESS_SPACE(width), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid range");
+
+	return peripheral_interface_i2c_eeprom_write(i2c, width, page_size, offset, data, length);
+}
+
+int peripheral_i2c_eeprom_read(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, uint32_t offset, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(width != PERIPHERAL_I2C_ADDRESS_WIDTH_8 && width != PERIPHERAL_I2C_ADDRESS_WIDTH_16, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid address width");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(length == 0 || (uint64_t)offset + length > I2C_ADDRESS_SPACE(width), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid range");
+
+	return peripheral_interface_i2c_eeprom_read(i2c, width, offset, data, length);
+}
+
+int peripheral_i2c_set_register_format(peripheral_i2c_h i2c, peripheral_i2c_address_width_e width, peripheral_i2c_endian_e endian)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(width != PERIPHERAL_I2C_ADDRESS_WIDTH_8 && width != PERIPHERAL_I2C_ADDRESS_WIDTH_16, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid address width");
+	RETVM_IF(endian != PERIPHERAL_I2C_ENDIAN_LITTLE && endian != PERIPHERAL_I2C_ENDIAN_BIG, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid endian");
+
+	return peripheral_interface_i2c_set_register_format(i2c, width, endian);
+}
+
+int peripheral_i2c_read_register_u16(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_i2c_read_register_words(i2c, reg, data, 1);
+}
+
+int peripheral_i2c_write_register_u16(peripheral_i2c_h i2c, uint16_t reg, uint16_t data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+
+	return peripheral_interface_i2c_write_register_words(i2c, reg, &data, 1);
+}
+
+int peripheral_i2c_read_register_u16_array(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data, uint32_t count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(count == 0 || count > I2C_WORDS_READ_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid count");
+
+	return peripheral_interface_i2c_read_register_words(i2c, reg, data, count);
+}
+
+int peripheral_i2c_write_register_u16_array(peripheral_i2c_h i2c, uint16_t reg, uint16_t *data, uint32_t count)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "I2C feature is not supported");
+	RETVM_IF(i2c == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "i2c handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(count == 0 || count > I2C_WORDS_WRITE_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid count");
+
+	return peripheral_interface_i2c_write_register_words(i2c, reg, data, count);
+}
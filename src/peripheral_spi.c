@@ -67,6 +67,8 @@ int peripheral_spi_open(int bus, int cs, peripheral_spi_h *spi)
 		_E("SPI open error (%d, %d)", bus, cs);
 		free(handle);
 		handle = NULL;
+	} else {
+		peripheral_interface_spi_probe(handle);
 	}
 
 	*spi = handle;
@@ -121,6 +123,21 @@ int peripheral_spi_set_bits_per_word(peripheral_spi_h spi, uint8_t bits)
 	return peripheral_interface_spi_set_bits_per_word(spi, bits);
 }
 
+static bool __is_bus_width(int width)
+{
+	return width == PERIPHERAL_SPI_BUS_WIDTH_SINGLE || width == PERIPHERAL_SPI_BUS_WIDTH_DUAL || width == PERIPHERAL_SPI_BUS_WIDTH_QUAD;
+}
+
+int peripheral_spi_set_bus_width(peripheral_spi_h spi, peripheral_spi_bus_width_e tx_width, peripheral_spi_bus_width_e rx_width)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(!__is_bus_width(tx_width), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid tx bus width");
+	RETVM_IF(!__is_bus_width(rx_width), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid rx bus width");
+
+	return peripheral_interface_spi_set_bus_width(spi, tx_width, rx_width);
+}
+
 int peripheral_spi_set_frequency(peripheral_spi_h spi, uint32_t freq_hz)
 {
 	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
@@ -155,3 +172,93 @@ int peripheral_spi_transfer(peripheral_spi_h spi, uint8_t *txdata, uint8_t *rxda
 
 	return peripheral_interface_spi_transfer(spi, txdata, rxdata, length);
 }
+
+int peripheral_spi_transfer_with_settings(peripheral_spi_h spi, uint8_t *txdata, uint8_t *rxdata, uint32_t length, uint32_t speed_hz, uint8_t bits_per_word)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(txdata == NULL && rxdata == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_spi_transfer_with_settings(spi, txdata, rxdata, length, speed_hz, bits_per_word);
+}
+
+int peripheral_spi_transfer_segments(peripheral_spi_h spi, peripheral_spi_segment_s *segments, int count)
+{
+	int index;
+
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(segments == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+	RETVM_IF(count <= 0 || count > SPI_SEGMENTS_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid count");
+
+	for (index = 0; index < count; index++) {
+		RETVM_IF(segments[index].length == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid length of segment %d", index);
+		RETVM_IF(segments[index].tx_nbits != 0 && !__is_bus_width(segments[index].tx_nbits), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid tx bus width of segment %d", index);
+		RETVM_IF(segments[index].rx_nbits != 0 && !__is_bus_width(segments[index].rx_nbits), PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid rx bus width of segment %d", index);
+	}
+
+	return peripheral_interface_spi_transfer_segments(spi, segments, count);
+}
+
+int peripheral_spi_set_chunk_cs_hold(peripheral_spi_h spi, bool hold)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+
+	return peripheral_interface_spi_set_chunk_cs_hold(spi, hold);
+}
+
+int peripheral_spi_get_max_transfer_size(peripheral_spi_h spi, uint32_t *size)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(size == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_spi_get_max_transfer_size(spi, size);
+}
+
+int peripheral_spi_start_stream(peripheral_spi_h spi, uint8_t *txdata, uint32_t frame_size, int frames, int count, peripheral_spi_stream_cb callback, void *user_data)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(frame_size == 0, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid frame size");
+	RETVM_IF(frames <= 0 || frames > SPI_SEGMENTS_MAX, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid number of frames");
+	RETVM_IF(count < 2, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid number of buffers");
+
+	return peripheral_interface_spi_start_stream(spi, txdata, frame_size, frames, count, callback, user_data);
+}
+
+int peripheral_spi_stop_stream(peripheral_spi_h spi)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+
+	return peripheral_interface_spi_stop_stream(spi);
+}
+
+int peripheral_spi_get_stream_fd(peripheral_spi_h spi, int *fd)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(fd == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_spi_get_stream_fd(spi, fd);
+}
+
+int peripheral_spi_read_stream(peripheral_spi_h spi, uint8_t *data, uint32_t length)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(data == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_spi_read_stream(spi, data, length);
+}
+
+int peripheral_spi_get_stream_overruns(peripheral_spi_h spi, uint32_t *overruns)
+{
+	RETVM_IF(__is_feature_supported() == false, PERIPHERAL_ERROR_NOT_SUPPORTED, "SPI feature is not supported");
+	RETVM_IF(spi == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "spi handle is NULL");
+	RETVM_IF(overruns == NULL, PERIPHERAL_ERROR_INVALID_PARAMETER, "Invalid parameter");
+
+	return peripheral_interface_spi_get_stream_overruns(spi, overruns);
+}
@@ -20,8 +20,10 @@
 int test_peripheral_io_gpio_initialize(char *model, bool feature);
 
 int test_peripheral_io_gpio_peripheral_gpio_open_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_open_p2(void);
 int test_peripheral_io_gpio_peripheral_gpio_open_n1(void);
 int test_peripheral_io_gpio_peripheral_gpio_open_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_open_n3(void);
 int test_peripheral_io_gpio_peripheral_gpio_close_p(void);
 int test_peripheral_io_gpio_peripheral_gpio_close_n(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_direction_p1(void);
@@ -37,7 +39,10 @@ int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_p4(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n1(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n2(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n3(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n4(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p2(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p3(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n1(void);
 int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2(void);
 int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p1(void);
@@ -49,5 +54,54 @@ int test_peripheral_io_gpio_peripheral_gpio_read_n2(void);
 int test_peripheral_io_gpio_peripheral_gpio_write_p(void);
 int test_peripheral_io_gpio_peripheral_gpio_write_n1(void);
 int test_peripheral_io_gpio_peripheral_gpio_write_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_open_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_open_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_open_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_close_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_close_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_set_direction_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_set_direction_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_read_mask_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_read_mask_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_write_mask_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_write_mask_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_read_events_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_read_events_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_count_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_count_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_read_pulses_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_read_pulses_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n1(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n2(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n3(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_n(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p2(void);
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_n(void);
 
 #endif /* __TEST_PERIPHERAL_GPIO_H__ */
\ No newline at end of file
@@ -41,5 +41,90 @@ int test_peripheral_io_i2c_peripheral_i2c_read_register_word_n1(void);
 int test_peripheral_io_i2c_peripheral_i2c_read_register_word_n2(void);
 int test_peripheral_io_i2c_peripheral_i2c_write_register_word_p(void);
 int test_peripheral_io_i2c_peripheral_i2c_write_register_word_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_destroy_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_reset_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_reset_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_update_register_bits_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_update_register_bits_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p2(void);
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p3(void);
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_async_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_async_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_async_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_async_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_async_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_async_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_async_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_async_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_async_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_create_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_create_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_destroy_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_add_job_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_add_job_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_start_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_stop_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_poller_read_samples_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n1(void);
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n2(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_format_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_set_register_format_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_n(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_p(void);
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_n(void);
 
 #endif /* __TEST_PERIPHERAL_I2C_H__ */
\ No newline at end of file
@@ -52,5 +52,30 @@ int test_peripheral_io_spi_peripheral_spi_transfer_p(void);
 int test_peripheral_io_spi_peripheral_spi_transfer_n1(void);
 int test_peripheral_io_spi_peripheral_spi_transfer_n2(void);
 int test_peripheral_io_spi_peripheral_spi_transfer_n3(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_p(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_n1(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_n2(void);
+int test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_p(void);
+int test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_n(void);
+int test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_p(void);
+int test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_n(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_p(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n1(void);
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n2(void);
+int test_peripheral_io_spi_peripheral_spi_start_stream_p(void);
+int test_peripheral_io_spi_peripheral_spi_start_stream_n1(void);
+int test_peripheral_io_spi_peripheral_spi_start_stream_n2(void);
+int test_peripheral_io_spi_peripheral_spi_start_stream_n3(void);
+int test_peripheral_io_spi_peripheral_spi_stop_stream_p(void);
+int test_peripheral_io_spi_peripheral_spi_stop_stream_n(void);
+int test_peripheral_io_spi_peripheral_spi_get_stream_fd_p(void);
+int test_peripheral_io_spi_peripheral_spi_get_stream_fd_n(void);
+int test_peripheral_io_spi_peripheral_spi_read_stream_n(void);
+int test_peripheral_io_spi_peripheral_spi_get_stream_overruns_p(void);
+int test_peripheral_io_spi_peripheral_spi_get_stream_overruns_n(void);
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_p(void);
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n1(void);
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n2(void);
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n3(void);
 
 #endif /* __TEST_PERIPHERAL_SPI_H__ */
\ No newline at end of file
@@ -149,10 +149,14 @@ static void __test_peripheral_gpio_run()
 
 	ret = test_peripheral_io_gpio_peripheral_gpio_open_p();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_open_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_open_p2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_open_p2");
 	ret = test_peripheral_io_gpio_peripheral_gpio_open_n1();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_open_n1");
 	ret = test_peripheral_io_gpio_peripheral_gpio_open_n2();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_open_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_open_n3();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_open_n3");
 	ret = test_peripheral_io_gpio_peripheral_gpio_close_p();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_close_p");
 	ret = test_peripheral_io_gpio_peripheral_gpio_close_n();
@@ -183,8 +187,14 @@ static void __test_peripheral_gpio_run()
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n2");
 	ret = test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n3();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n3");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n4();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n4");
 	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p3();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p3");
 	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n1();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n1");
 	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2();
@@ -207,6 +217,104 @@ static void __test_peripheral_gpio_run()
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_write_n1");
 	ret = test_peripheral_io_gpio_peripheral_gpio_write_n2();
 	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_write_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_open_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_open_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_open_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_open_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_open_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_open_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_close_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_close_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_close_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_close_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_set_direction_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_set_direction_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_set_direction_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_set_direction_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_read_mask_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_read_mask_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_read_mask_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_read_mask_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_write_mask_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_write_mask_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_write_mask_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_write_mask_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_event_queue_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_event_queue_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_read_events_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_read_events_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_read_events_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_read_events_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_debounce_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_debounce_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_debounce_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_debounce_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_debounce_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_debounce_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_get_edge_count_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_get_edge_count_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_get_edge_count_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_get_edge_count_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_read_pulses_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_read_pulses_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_read_pulses_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_read_pulses_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n1();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n1");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n3();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n3");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_n");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p2();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p2");
+	ret = test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_n();
+	__error_check(ret, "test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_n");
 }
 
 static void __test_peripheral_i2c_run()
@@ -257,6 +365,176 @@ static void __test_peripheral_i2c_run()
 	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_word_p");
 	ret = test_peripheral_io_i2c_peripheral_i2c_write_register_word_n();
 	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_word_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_registers_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_registers_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_registers_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_registers_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_registers_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_registers_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_registers_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_registers_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_registers_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_registers_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_registers_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_registers_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_create_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_create_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_create_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_create_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_create_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_create_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_destroy_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_destroy_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_submit_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_submit_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_submit_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_submit_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_reset_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_reset_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_reset_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_reset_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_block_data_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_block_data_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_block_data_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_block_data_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_block_data_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_block_data_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_block_data_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_block_data_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_block_data_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_block_data_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_block_data_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_block_data_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_update_register_bits_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_update_register_bits_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_update_register_bits_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_update_register_bits_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_sync_registers_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_sync_registers_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_sync_registers_p2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_sync_registers_p2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_sync_registers_p3();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_sync_registers_p3");
+	ret = test_peripheral_io_i2c_peripheral_i2c_sync_registers_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_sync_registers_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_async_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_async_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_async_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_async_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_async_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_async_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_async_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_async_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_registers_async_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_registers_async_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_registers_async_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_registers_async_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_registers_async_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_registers_async_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_registers_async_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_registers_async_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_transaction_submit_async_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_transaction_submit_async_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_priority_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_priority_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_priority_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_priority_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_priority_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_priority_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_create_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_create_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_create_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_create_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_destroy_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_destroy_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_add_job_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_add_job_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_add_job_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_add_job_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_start_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_start_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_stop_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_stop_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_poller_read_samples_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_poller_read_samples_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_write_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_write_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_read_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_read_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n1();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n1");
+	ret = test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n2();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n2");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_format_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_format_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_set_register_format_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_set_register_format_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_register_u16_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_register_u16_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_register_u16_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_register_u16_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_register_u16_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_u16_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_register_u16_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_u16_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_n");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_p();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_p");
+	ret = test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_n();
+	__error_check(ret, "test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_n");
 }
 
 static void __test_peripheral_pwm_run()
@@ -524,6 +802,56 @@ static void __test_peripheral_spi_run()
 	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_n2");
 	ret = test_peripheral_io_spi_peripheral_spi_transfer_n3();
 	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_n3");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_segments_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_segments_p");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_segments_n1();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_segments_n1");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_segments_n2();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_segments_n2");
+	ret = test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_p");
+	ret = test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_n");
+	ret = test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_p");
+	ret = test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_n");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_with_settings_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_with_settings_p");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n1();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n1");
+	ret = test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n2();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n2");
+	ret = test_peripheral_io_spi_peripheral_spi_start_stream_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_start_stream_p");
+	ret = test_peripheral_io_spi_peripheral_spi_start_stream_n1();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_start_stream_n1");
+	ret = test_peripheral_io_spi_peripheral_spi_start_stream_n2();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_start_stream_n2");
+	ret = test_peripheral_io_spi_peripheral_spi_start_stream_n3();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_start_stream_n3");
+	ret = test_peripheral_io_spi_peripheral_spi_stop_stream_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_stop_stream_p");
+	ret = test_peripheral_io_spi_peripheral_spi_stop_stream_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_stop_stream_n");
+	ret = test_peripheral_io_spi_peripheral_spi_get_stream_fd_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_stream_fd_p");
+	ret = test_peripheral_io_spi_peripheral_spi_get_stream_fd_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_stream_fd_n");
+	ret = test_peripheral_io_spi_peripheral_spi_read_stream_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_read_stream_n");
+	ret = test_peripheral_io_spi_peripheral_spi_get_stream_overruns_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_stream_overruns_p");
+	ret = test_peripheral_io_spi_peripheral_spi_get_stream_overruns_n();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_get_stream_overruns_n");
+	ret = test_peripheral_io_spi_peripheral_spi_set_bus_width_p();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_bus_width_p");
+	ret = test_peripheral_io_spi_peripheral_spi_set_bus_width_n1();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_bus_width_n1");
+	ret = test_peripheral_io_spi_peripheral_spi_set_bus_width_n2();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_bus_width_n2");
+	ret = test_peripheral_io_spi_peripheral_spi_set_bus_width_n3();
+	__error_check(ret, "test_peripheral_io_spi_peripheral_spi_set_bus_width_n3");
 }
 
 int main(int argc, char **argv)
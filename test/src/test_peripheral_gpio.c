@@ -70,6 +70,55 @@ int test_peripheral_io_gpio_peripheral_gpio_open_p(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
+int test_peripheral_io_gpio_peripheral_gpio_open_p2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+	uint32_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		/* The pin driven through the opened line must read back the same, whichever backend was chosen */
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_write(gpio_h, 1);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_read(gpio_h, &value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		if (value != 1) {
+			peripheral_gpio_close(gpio_h);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
 int test_peripheral_io_gpio_peripheral_gpio_open_n1(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
@@ -108,6 +157,39 @@ int test_peripheral_io_gpio_peripheral_gpio_open_n2(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
+int test_peripheral_io_gpio_peripheral_gpio_open_n3(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+	peripheral_gpio_h gpio_h2 = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		/* The line is already requested, so the chardev is refused and so is the fallback */
+		ret = peripheral_gpio_open(pin, &gpio_h2);
+		if (ret == PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h2);
+			peripheral_gpio_close(gpio_h);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
 int test_peripheral_io_gpio_peripheral_gpio_close_p(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
@@ -534,21 +616,14 @@ int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n3(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-static void gpio_interrupted_cb(peripheral_gpio_h gpio_h, peripheral_error_e error, void *user_data)
-{
-	// interrupted callback
-}
-
-int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_mode_n4(void)
 {
-	// see the gpio_interrupted_cb();
-
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
 	if (g_feature == false) {
-		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -563,19 +638,33 @@ int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p(void)
 			return ret;
 		}
 
-		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
 
-		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 64);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
 
-		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		/* The pulse capture needs both edges */
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_RESOURCE_BUSY) {
+			peripheral_gpio_unset_pulse_capture(gpio_h);
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_unset_pulse_capture(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
@@ -589,32 +678,21 @@ int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n1(void)
+static void gpio_interrupted_cb(peripheral_gpio_h gpio_h, peripheral_error_e error, void *user_data)
 {
-	int ret = PERIPHERAL_ERROR_NONE;
-
-	if (g_feature == false) {
-		ret = peripheral_gpio_set_interrupted_cb(NULL, gpio_interrupted_cb, NULL);
-		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
-			return ret;
-
-	} else {
-		ret = peripheral_gpio_set_interrupted_cb(NULL, gpio_interrupted_cb, NULL);
-		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
-			return ret;
-	}
-
-	return PERIPHERAL_ERROR_NONE;
+	// interrupted callback
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p(void)
 {
+	// see the gpio_interrupted_cb();
+
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
 	if (g_feature == false) {
-		ret = peripheral_gpio_set_interrupted_cb(gpio_h, NULL, NULL);
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -623,8 +701,26 @@ int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2(void)
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
-		ret = peripheral_gpio_set_interrupted_cb(gpio_h, NULL, NULL);
-		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
@@ -637,14 +733,14 @@ int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p1(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p2(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
 	if (g_feature == false) {
-		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -653,6 +749,25 @@ int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p1(void)
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		/* Registering again replaces the callback in the shared dispatcher */
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
 		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
@@ -673,14 +788,14 @@ int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p1(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p2(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_p3(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
 	if (g_feature == false) {
-		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -689,52 +804,29 @@ int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p2(void)
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
-		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
 
-		ret = peripheral_gpio_close(gpio_h);
-		if (ret != PERIPHERAL_ERROR_NONE)
-			return ret;
-	}
-
-	return PERIPHERAL_ERROR_NONE;
-}
-
-int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_n(void)
-{
-	int ret = PERIPHERAL_ERROR_NONE;
-
-	if (g_feature == false) {
-		ret = peripheral_gpio_unset_interrupted_cb(NULL);
-		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
 			return ret;
+		}
 
-	} else {
-		ret = peripheral_gpio_unset_interrupted_cb(NULL);
-		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
 			return ret;
-	}
-
-	return PERIPHERAL_ERROR_NONE;
-}
-
-int test_peripheral_io_gpio_peripheral_gpio_read_p(void)
-{
-	int ret = PERIPHERAL_ERROR_NONE;
-
-	peripheral_gpio_h gpio_h = NULL;
-
-	uint32_t value;
+		}
 
-	if (g_feature == false) {
-		ret = peripheral_gpio_read(gpio_h, &value);
-		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+		/* Closing a handle still registered must remove it from the shared dispatcher */
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
-	} else {
 		ret = peripheral_gpio_open(pin, &gpio_h);
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
@@ -745,7 +837,13 @@ int test_peripheral_io_gpio_peripheral_gpio_read_p(void)
 			return ret;
 		}
 
-		ret = peripheral_gpio_read(gpio_h, &value);
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
@@ -759,19 +857,17 @@ int test_peripheral_io_gpio_peripheral_gpio_read_p(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_read_n1(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n1(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
 
-	uint32_t value;
-
 	if (g_feature == false) {
-		ret = peripheral_gpio_read(NULL, &value);
+		ret = peripheral_gpio_set_interrupted_cb(NULL, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
 	} else {
-		ret = peripheral_gpio_read(NULL, &value);
+		ret = peripheral_gpio_set_interrupted_cb(NULL, gpio_interrupted_cb, NULL);
 		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
 			return ret;
 	}
@@ -779,14 +875,14 @@ int test_peripheral_io_gpio_peripheral_gpio_read_n1(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_read_n2(void)
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_n2(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
 	if (g_feature == false) {
-		ret = peripheral_gpio_read(gpio_h, NULL);
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, NULL, NULL);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -795,13 +891,7 @@ int test_peripheral_io_gpio_peripheral_gpio_read_n2(void)
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
-		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
-		if (ret != PERIPHERAL_ERROR_NONE) {
-			peripheral_gpio_close(gpio_h);
-			return ret;
-		}
-
-		ret = peripheral_gpio_read(gpio_h, NULL);
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, NULL, NULL);
 		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
@@ -815,16 +905,14 @@ int test_peripheral_io_gpio_peripheral_gpio_read_n2(void)
 	return PERIPHERAL_ERROR_NONE;
 }
 
-int test_peripheral_io_gpio_peripheral_gpio_write_p(void)
+int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p1(void)
 {
 	int ret = PERIPHERAL_ERROR_NONE;
 
 	peripheral_gpio_h gpio_h = NULL;
 
-	uint32_t value = 1;
-
 	if (g_feature == false) {
-		ret = peripheral_gpio_write(gpio_h, value);
+		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
 		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
 			return ret;
 
@@ -833,24 +921,216 @@ int test_peripheral_io_gpio_peripheral_gpio_write_p(void)
 		if (ret != PERIPHERAL_ERROR_NONE)
 			return ret;
 
-		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
 
-		ret = peripheral_gpio_write(gpio_h, value);
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
 		if (ret != PERIPHERAL_ERROR_NONE) {
 			peripheral_gpio_close(gpio_h);
 			return ret;
 		}
 
-		ret = peripheral_gpio_close(gpio_h);
-		if (ret != PERIPHERAL_ERROR_NONE)
+		ret = peripheral_gpio_set_interrupted_cb(gpio_h, gpio_interrupted_cb, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
 			return ret;
-	}
+		}
 
-	return PERIPHERAL_ERROR_NONE;
+		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_p2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_unset_interrupted_cb(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_interrupted_cb_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_interrupted_cb(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_unset_interrupted_cb(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	uint32_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read(gpio_h, &value);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_read(gpio_h, &value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint32_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read(NULL, &value);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_read(NULL, &value);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read(gpio_h, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_read(gpio_h, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_write_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	uint32_t value = 1;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_write(gpio_h, value);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_write(gpio_h, value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
 }
 
 int test_peripheral_io_gpio_peripheral_gpio_write_n1(void)
@@ -910,3 +1190,1510 @@ int test_peripheral_io_gpio_peripheral_gpio_write_n2(void)
 
 	return PERIPHERAL_ERROR_NONE;
 }
+
+int test_peripheral_io_gpio_peripheral_gpio_port_open_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_open_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_open(&pin, 1, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_open_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_open(&pin, 0, &port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 0, &port_h);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_close_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_close_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_close(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_close(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_set_direction_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_set_direction_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_set_direction(port_h, 0x2, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x2, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_read_mask_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	uint64_t bits;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_read_mask(port_h, 0x1, &bits);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_read_mask(port_h, 0x1, &bits);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_read_mask_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_read_mask(port_h, 0x1, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_read_mask(port_h, 0x1, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_write_mask_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_write_mask(port_h, 0x1, 0x1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_write_mask(port_h, 0x1, 0x1);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_write_mask_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_write_mask(NULL, 0x1, 0x1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_write_mask(NULL, 0x1, 0x1);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_event_queue(gpio_h, 64);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_event_queue(gpio_h, 64);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_unset_event_queue(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_event_queue(NULL, 64);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_set_event_queue(NULL, 64);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_event_queue_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_event_queue(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_event_queue(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_event_queue(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_unset_event_queue(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_event_queue_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_event_queue(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_unset_event_queue(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_events_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	peripheral_gpio_event_s events[8];
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read_events(gpio_h, events, 8, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_event_queue(gpio_h, 8);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_read_events(gpio_h, events, 8, &count);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_events_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read_events(gpio_h, NULL, 8, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_read_events(gpio_h, NULL, 8, &count);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_interrupted_cb_delivery(gpio_h, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_interrupted_cb_delivery(gpio_h, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_interrupted_cb_delivery(NULL, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_set_interrupted_cb_delivery(NULL, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_interrupted_cb_delivery_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_interrupted_cb_delivery(gpio_h, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT + 1, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_interrupted_cb_delivery(gpio_h, PERIPHERAL_GPIO_CALLBACK_DELIVERY_DIRECT + 1, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_debounce(gpio_h, 1000, 100);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_debounce(gpio_h, 1000, 100);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_debounce(gpio_h, 0, 0);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_debounce(NULL, 1000, 100);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_set_debounce(NULL, 1000, 100);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_debounce_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_debounce(gpio_h, 1000001, 100);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_debounce(gpio_h, 1000001, 100);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_unset_edge_counter(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_edge_counter(NULL, 1000);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_set_edge_counter(NULL, 1000);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_edge_counter_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_edge_counter(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_unset_edge_counter(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_edge_counter_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_edge_counter(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_unset_edge_counter(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_count_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+	uint64_t count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_get_edge_count(gpio_h, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_get_edge_count(gpio_h, &count);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_count_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint64_t count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_get_edge_count(NULL, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_get_edge_count(NULL, &count);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+	double frequency;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_get_edge_frequency(gpio_h, &frequency);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_RISING);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_counter(gpio_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_get_edge_frequency(gpio_h, &frequency);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_get_edge_frequency_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	double frequency;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_get_edge_frequency(NULL, &frequency);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_get_edge_frequency(NULL, &frequency);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 64);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 64);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_unset_pulse_capture(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_pulse_capture(NULL, 64);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_set_pulse_capture(NULL, 64);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_set_pulse_capture_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 0);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_pulse_capture(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_unset_pulse_capture(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_unset_pulse_capture_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_unset_pulse_capture(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_unset_pulse_capture(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_pulses_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_h gpio_h = NULL;
+	peripheral_gpio_pulse_s pulses[16];
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read_pulses(gpio_h, pulses, 16, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_open(pin, &gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_set_direction(gpio_h, PERIPHERAL_GPIO_DIRECTION_IN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_edge_mode(gpio_h, PERIPHERAL_GPIO_EDGE_BOTH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_set_pulse_capture(gpio_h, 64);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_read_pulses(gpio_h, pulses, 16, &count);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_close(gpio_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_close(gpio_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_read_pulses_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_pulse_s pulses[16];
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_read_pulses(NULL, pulses, 16, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_read_pulses(NULL, pulses, 16, &count);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 10000}, {0x1, 0x0, 10000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 1);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_wait_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 10000}, {0x1, 0x0, 10000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_start_waveform(NULL, steps, 2, 1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_start_waveform(NULL, steps, 2, 1);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 10000}, {0x1, 0x0, 10000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 0, 1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 0, 1);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_start_waveform_n3(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 0}, {0x1, 0x0, 0}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 0);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 0);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 10000}, {0x1, 0x0, 10000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_wait_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 2);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_wait_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_wait_waveform_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_wait_waveform(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_wait_waveform(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 10000}, {0x1, 0x0, 10000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_stop_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 0);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_stop_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_p2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_gpio_port_h port_h = NULL;
+	peripheral_gpio_waveform_step_s steps[2] = {{0x1, 0x1, 1000000000}, {0x1, 0x0, 1000000000}};
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_stop_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_open(&pin, 1, &port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_gpio_port_set_direction(port_h, 0x1, PERIPHERAL_GPIO_DIRECTION_OUT_INITIALLY_LOW);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_start_waveform(port_h, steps, 2, 0);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		/* The pins belong to the waveform until it is stopped */
+		ret = peripheral_gpio_port_write_mask(port_h, 0x1, 0x1);
+		if (ret != PERIPHERAL_ERROR_RESOURCE_BUSY) {
+			peripheral_gpio_port_stop_waveform(port_h);
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		/* Stopping does not wait for the end of the one second step */
+		ret = peripheral_gpio_port_stop_waveform(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_gpio_port_close(port_h);
+			return ret;
+		}
+
+		ret = peripheral_gpio_port_close(port_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_gpio_peripheral_gpio_port_stop_waveform_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_gpio_port_stop_waveform(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_gpio_port_stop_waveform(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
@@ -609,3 +609,2429 @@ int test_peripheral_io_i2c_peripheral_i2c_write_register_word_n(void)
 
 	return PERIPHERAL_ERROR_NONE;
 }
+
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_registers(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_registers(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_registers(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_registers(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_registers(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_registers(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_registers(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_registers(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_registers(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_registers(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_registers(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_registers(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_transaction_h transaction_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_create(NULL, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_create(NULL, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_create_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_create(i2c_h, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_destroy_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_destroy(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_destroy(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+	uint8_t reg = I2C_REGISTER;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_add_write(transaction_h, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_add_write(transaction_h, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_write_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t reg = I2C_REGISTER;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_add_write(NULL, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_add_write(NULL, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_add_read(transaction_h, buf, I2C_BUFFER_LEN, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_add_read(transaction_h, buf, I2C_BUFFER_LEN, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_add_read_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_add_read(NULL, buf, I2C_BUFFER_LEN, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_add_read(NULL, buf, I2C_BUFFER_LEN, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+	uint8_t reg = I2C_REGISTER;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_submit(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_add_write(transaction_h, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_add_read(transaction_h, buf, I2C_BUFFER_LEN, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_submit(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_submit(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_submit(transaction_h);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_reset_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transaction_h transaction_h = NULL;
+	uint8_t reg = I2C_REGISTER;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_reset(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_transaction_create(i2c_h, &transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_add_write(transaction_h, &reg, 1, PERIPHERAL_I2C_MESSAGE_FLAG_NONE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_reset(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_transaction_destroy(transaction_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_transaction_destroy(transaction_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_reset_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_reset(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_reset(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_transfer_path_e path;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_get_transfer_path(i2c_h, &path);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_get_transfer_path(i2c_h, &path);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_transfer_path_e path;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_get_transfer_path(NULL, &path);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_get_transfer_path(NULL, &path);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_get_transfer_path_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_get_transfer_path(i2c_h, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_get_transfer_path(i2c_h, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+	uint32_t length = I2C_BUFFER_LEN;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_block_data(i2c_h, I2C_REGISTER, buf, &length);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_block_data(i2c_h, I2C_REGISTER, buf, &length);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+	uint32_t length = I2C_BUFFER_LEN;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_block_data(NULL, I2C_REGISTER, buf, &length);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_block_data(NULL, I2C_REGISTER, buf, &length);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_block_data_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint32_t length = I2C_BUFFER_LEN;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_block_data(i2c_h, I2C_REGISTER, NULL, &length);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_block_data(i2c_h, I2C_REGISTER, NULL, &length);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_block_data_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[33] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_block_data(i2c_h, I2C_REGISTER, buf, 33);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_block_data(i2c_h, I2C_REGISTER, buf, 33);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_i2c_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_i2c_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_i2c_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_i2c_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_i2c_block_data_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_i2c_block_data(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_i2c_block_data(i2c_h, I2C_REGISTER, NULL, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_i2c_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_i2c_block_data(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_i2c_block_data_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN] = {I2C_BUFFER_VALUE, };
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_i2c_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_i2c_block_data(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, false);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cacheable_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_cacheable(NULL, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_set_register_cacheable(NULL, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_THROUGH);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_cache_mode(NULL, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_set_register_cache_mode(NULL, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_cache_mode_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK + 1);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK + 1);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_update_register_bits_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_update_register_bits(i2c_h, I2C_REGISTER, 0x01, 0x01);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_update_register_bits(i2c_h, I2C_REGISTER, 0x01, 0x01);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_update_register_bits_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_update_register_bits(NULL, I2C_REGISTER, 0x01, 0x01);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_update_register_bits(NULL, I2C_REGISTER, 0x01, 0x01);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_sync_registers(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_write_register_byte(i2c_h, I2C_REGISTER, I2C_BUFFER_VALUE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_sync_registers(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t pointer = I2C_REGISTER;
+	uint8_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_sync_registers(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_write_register_byte(i2c_h, I2C_REGISTER, I2C_BUFFER_VALUE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		/* A raw write must not drop the value held back in the cache */
+		ret = peripheral_i2c_write(i2c_h, &pointer, 1);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_sync_registers(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_invalidate_register_cache(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_read_register_byte(i2c_h, I2C_REGISTER, &value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		if (value != I2C_BUFFER_VALUE) {
+			peripheral_i2c_close(i2c_h);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_p3(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_sync_registers(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_set_register_cache_mode(i2c_h, PERIPHERAL_I2C_REGISTER_CACHE_WRITE_BACK);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_write_register_byte(i2c_h, I2C_REGISTER, I2C_BUFFER_VALUE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		/* A block read must see the value held back in the cache */
+		ret = peripheral_i2c_read_registers(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		if (buf[0] != I2C_BUFFER_VALUE) {
+			peripheral_i2c_close(i2c_h);
+			return PERIPHERAL_ERROR_IO_ERROR;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_sync_registers_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_sync_registers(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_sync_registers(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_invalidate_register_cache(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_cacheable(i2c_h, I2C_REGISTER, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_invalidate_register_cache(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_invalidate_register_cache_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_invalidate_register_cache(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_invalidate_register_cache(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_async_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_async(i2c_h, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_async(i2c_h, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_async_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_async(NULL, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_async(NULL, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_async_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_async(i2c_h, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_async(i2c_h, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_async_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_async(NULL, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_async(NULL, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_async_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_registers_async(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_registers_async(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_registers_async_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_registers_async(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_registers_async(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_async_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_registers_async(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_registers_async(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_registers_async_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_registers_async(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_registers_async(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_transaction_submit_async_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_transaction_submit_async(NULL, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_transaction_submit_async(NULL, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	int fd;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_get_completion_fd(i2c_h, &fd);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_get_completion_fd(i2c_h, &fd);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_get_completion_fd_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	int fd;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_get_completion_fd(NULL, &fd);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_get_completion_fd(NULL, &fd);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_priority(i2c_h, 10);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_priority(i2c_h, 10);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_priority(NULL, 10);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_set_priority(NULL, 10);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_priority_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_priority(i2c_h, 100);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_priority(i2c_h, 100);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_max_hold_time(i2c_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_max_hold_time(i2c_h, 1000);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_max_hold_time_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_max_hold_time(NULL, 1000);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_set_max_hold_time(NULL, 1000);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_create_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_poller_h poller_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_create(&poller_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_create(&poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_poller_destroy(poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_create_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_create(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_create(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_destroy_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_destroy(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_destroy(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_add_job_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	peripheral_i2c_poller_h poller_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+	int job;
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_add_job(poller_h, i2c_h, I2C_REGISTER, 1, 10000, I2C_BUFFER_LEN, &job);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_poller_create(&poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_poller_add_job(poller_h, i2c_h, I2C_REGISTER, 1, 10000, I2C_BUFFER_LEN, &job);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_poller_destroy(poller_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_poller_start(poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_poller_destroy(poller_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_poller_stop(poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_poller_destroy(poller_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_poller_read_samples(poller_h, job, buf, NULL, I2C_BUFFER_LEN, &count);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_poller_destroy(poller_h);
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_poller_destroy(poller_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_add_job_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	int job;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_add_job(NULL, NULL, I2C_REGISTER, 1, 10000, I2C_BUFFER_LEN, &job);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_add_job(NULL, NULL, I2C_REGISTER, 1, 10000, I2C_BUFFER_LEN, &job);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_start_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_start(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_start(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_stop_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_stop(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_stop(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_poller_read_samples_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+	int count;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_poller_read_samples(NULL, 0, buf, NULL, I2C_BUFFER_LEN, &count);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_poller_read_samples(NULL, 0, buf, NULL, I2C_BUFFER_LEN, &count);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_write(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_eeprom_write(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_write(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_eeprom_write(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_write_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_write(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 0, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_eeprom_write(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 0, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_read(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_eeprom_read(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_read(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_eeprom_read(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_eeprom_read_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint8_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_eeprom_read(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 0xff, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_eeprom_read(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, 0xff, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_format_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_format(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_format(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_set_register_format_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_set_register_format(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_set_register_format(NULL, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint16_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_register_u16(i2c_h, I2C_REGISTER, &value);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_format(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_read_register_u16(i2c_h, I2C_REGISTER, &value);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint16_t value;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_register_u16(NULL, I2C_REGISTER, &value);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_register_u16(NULL, I2C_REGISTER, &value);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_register_u16(i2c_h, I2C_REGISTER, 0x1234);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_set_register_format(i2c_h, PERIPHERAL_I2C_ADDRESS_WIDTH_8, PERIPHERAL_I2C_ENDIAN_BIG);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_write_register_u16(i2c_h, I2C_REGISTER, 0x1234);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_register_u16(NULL, I2C_REGISTER, 0x1234);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_register_u16(NULL, I2C_REGISTER, 0x1234);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint16_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_register_u16_array(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_read_register_u16_array(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_read_register_u16_array_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint16_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_read_register_u16_array(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_read_register_u16_array(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_i2c_h i2c_h = NULL;
+	uint16_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_register_u16_array(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_open(bus, address, &i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_i2c_write_register_u16_array(i2c_h, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_i2c_close(i2c_h);
+			return ret;
+		}
+
+		ret = peripheral_i2c_close(i2c_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_i2c_peripheral_i2c_write_register_u16_array_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint16_t buf[I2C_BUFFER_LEN];
+
+	if (g_feature == false) {
+		ret = peripheral_i2c_write_register_u16_array(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_i2c_write_register_u16_array(NULL, I2C_REGISTER, buf, I2C_BUFFER_LEN);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
@@ -29,8 +29,12 @@
 #define SPI_CS_INVALID -99
 #define SPI_BITS_PER_WORD 8
 #define SPI_BITS_PER_WORD_INVALID 1
+#define SPI_BUS_WIDTH_INVALID 3
 #define SPI_FREQUENCY 15000
 #define SPI_BUFFER_LEN 1
+#define SPI_STREAM_FRAMES 4
+#define SPI_STREAM_BUFFERS 2
+#define SPI_STREAM_FRAME_SIZE_INVALID 0x80000000
 #define	SPI_WRITE_DATA 0x00
 
 static bool g_feature = true;
@@ -949,3 +953,729 @@ int test_peripheral_io_spi_peripheral_spi_transfer_n3(void)
 
 	return PERIPHERAL_ERROR_NONE;
 }
+
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint8_t tx_data = SPI_WRITE_DATA;
+	uint8_t rx_data;
+	peripheral_spi_segment_s segments[2] = {
+		{ .txdata = &tx_data, .length = SPI_BUFFER_LEN },
+		{ .rxdata = &rx_data, .length = SPI_BUFFER_LEN },
+	};
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_segments(spi_h, segments, 2);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_transfer_segments(spi_h, segments, 2);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t tx_data = SPI_WRITE_DATA;
+	uint8_t rx_data;
+	peripheral_spi_segment_s segments[2] = {
+		{ .txdata = &tx_data, .length = SPI_BUFFER_LEN },
+		{ .rxdata = &rx_data, .length = SPI_BUFFER_LEN },
+	};
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_segments(NULL, segments, 2);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_transfer_segments(NULL, segments, 2);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_transfer_segments_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint8_t tx_data = SPI_WRITE_DATA;
+	uint8_t rx_data;
+	peripheral_spi_segment_s segments[2] = {
+		{ .txdata = &tx_data, .length = SPI_BUFFER_LEN },
+		{ .rxdata = &rx_data, .length = SPI_BUFFER_LEN },
+	};
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_segments(spi_h, segments, 0);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_transfer_segments(spi_h, segments, 0);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_chunk_cs_hold(spi_h, true);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_set_chunk_cs_hold(spi_h, true);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_chunk_cs_hold_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_chunk_cs_hold(NULL, true);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_set_chunk_cs_hold(NULL, true);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint32_t size;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_max_transfer_size(spi_h, &size);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_get_max_transfer_size(spi_h, &size);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_max_transfer_size_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint32_t size;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_max_transfer_size(NULL, &size);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_get_max_transfer_size(NULL, &size);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint8_t tx_data = SPI_WRITE_DATA;
+	uint8_t rx_data;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_with_settings(spi_h, &tx_data, &rx_data, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_transfer_with_settings(spi_h, &tx_data, &rx_data, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	uint8_t tx_data = SPI_WRITE_DATA;
+	uint8_t rx_data;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_with_settings(NULL, &tx_data, &rx_data, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_transfer_with_settings(NULL, &tx_data, &rx_data, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_transfer_with_settings_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_transfer_with_settings(spi_h, NULL, NULL, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_transfer_with_settings(spi_h, NULL, NULL, SPI_BUFFER_LEN, SPI_FREQUENCY, SPI_BITS_PER_WORD);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_start_stream_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_stop_stream(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_start_stream_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_start_stream(NULL, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_start_stream(NULL, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_start_stream_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, 1, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, 1, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_start_stream_n3(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_STREAM_FRAME_SIZE_INVALID, 2, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_STREAM_FRAME_SIZE_INVALID, 2, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_stop_stream_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_stop_stream(spi_h);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_stop_stream(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_stop_stream_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_stop_stream(NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_stop_stream(NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_stream_fd_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	int fd;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_stream_fd(spi_h, &fd);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_get_stream_fd(spi_h, &fd);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_stop_stream(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_stream_fd_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_stream_fd(spi_h, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_get_stream_fd(spi_h, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_read_stream_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint8_t buf[SPI_BUFFER_LEN * SPI_STREAM_FRAMES];
+
+	if (g_feature == false) {
+		ret = peripheral_spi_read_stream(spi_h, buf, SPI_BUFFER_LEN * SPI_STREAM_FRAMES);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_read_stream(spi_h, buf, SPI_BUFFER_LEN * SPI_STREAM_FRAMES);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_stream_overruns_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+	uint32_t overruns;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_stream_overruns(spi_h, &overruns);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_start_stream(spi_h, NULL, SPI_BUFFER_LEN, SPI_STREAM_FRAMES, SPI_STREAM_BUFFERS, NULL, NULL);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_get_stream_overruns(spi_h, &overruns);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_stop_stream(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_get_stream_overruns_n(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_get_stream_overruns(spi_h, NULL);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_get_stream_overruns(spi_h, NULL);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_p(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_bus_width(spi_h, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_set_bus_width(spi_h, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_NONE) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n1(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_bus_width(NULL, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_set_bus_width(NULL, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n2(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_bus_width(spi_h, SPI_BUS_WIDTH_INVALID, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_set_bus_width(spi_h, SPI_BUS_WIDTH_INVALID, PERIPHERAL_SPI_BUS_WIDTH_SINGLE);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}
+
+int test_peripheral_io_spi_peripheral_spi_set_bus_width_n3(void)
+{
+	int ret = PERIPHERAL_ERROR_NONE;
+
+	peripheral_spi_h spi_h = NULL;
+
+	if (g_feature == false) {
+		ret = peripheral_spi_set_bus_width(spi_h, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, SPI_BUS_WIDTH_INVALID);
+		if (ret != PERIPHERAL_ERROR_NOT_SUPPORTED)
+			return ret;
+
+	} else {
+		ret = peripheral_spi_open(bus, cs, &spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+
+		ret = peripheral_spi_set_bus_width(spi_h, PERIPHERAL_SPI_BUS_WIDTH_SINGLE, SPI_BUS_WIDTH_INVALID);
+		if (ret != PERIPHERAL_ERROR_INVALID_PARAMETER) {
+			peripheral_spi_close(spi_h);
+			return ret;
+		}
+
+		ret = peripheral_spi_close(spi_h);
+		if (ret != PERIPHERAL_ERROR_NONE)
+			return ret;
+	}
+
+	return PERIPHERAL_ERROR_NONE;
+}